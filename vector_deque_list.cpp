@@ -2,20 +2,45 @@
 // What: Benchmark for vector/deque/list + helpers (avg/variance)
 // Why : Measure copy/read/statistics performance; keep code simple & clear
 // RELEVANT FILES: Makefile, README.md, vector_deque_list.rs
-#include <algorithm>    // std::generate, std::copy, std::copy_n, std::min
+#include <algorithm>    // std::generate, std::copy, std::copy_n, std::min, std::sort, std::stable_sort, std::nth_element
 #include <array>        // std::array
+#include <atomic>       // std::atomic
+#include <cerrno>       // errno
+#include <cmath>        // std::ceil, std::pow, std::sqrt, std::nextafter
 #include <chrono>       // std::chrono::steady_clock, std::chrono::duration, std::chrono::duration_cast, std::chrono::time_point
+#include <cstdint>      // std::uint32_t, std::uint64_t
+#include <cstring>      // std::memcmp, std::strerror
 #include <deque>        // std::deque
-#include <iomanip>      // std::setprecision, std::fixed
-#include <iostream>     // std::cout, std::cin, std::endl
+#include <exception>    // std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <functional>   // std::function, std::greater
+#include <fstream>      // std::ofstream
+#include <iomanip>      // std::setprecision, std::fixed, std::hex, std::setw, std::setfill
+#include <iostream>     // std::cout, std::cerr, std::endl
+#include <condition_variable>  // std::condition_variable
 #include <iterator>     // std::back_inserter, std::ostream_iterator
+#include <limits>       // std::numeric_limits
 #include <list>         // std::list
-#include <numeric>      // std::accumulate
-#include <random>       // std::random_device, std::mt19937, std::uniform_int_distribution
-#include <string>       // std::string
-#include <type_traits>  // std::decay_t
+#include <map>          // std::map
+#include <memory>       // std::unique_ptr, std::make_unique
+#include <new>          // std::hardware_destructive_interference_size
+#include <mutex>        // std::mutex, std::lock_guard, std::unique_lock
+#include <queue>        // std::queue, std::priority_queue
+#include <numeric>      // std::accumulate, std::lcm
+#include <optional>     // std::optional
+#include <random>       // std::mt19937
+#include <stdexcept>    // std::invalid_argument, std::runtime_error, std::length_error
+#include <string>       // std::string, std::stoull, std::to_string
+#include <thread>       // std::thread, std::this_thread::yield
+#include <type_traits>  // std::decay_t, std::make_unsigned_t, std::is_signed_v, std::conditional_t
+#include <unordered_map>  // std::unordered_map
+#include <utility>      // std::exchange, std::move
 #include <vector>       // std::vector
 
+#include <fcntl.h>      // open
+#include <sys/mman.h>   // mmap, munmap, madvise
+#include <sys/stat.h>   // fstat
+#include <unistd.h>     // close
+
 /**
  * @brief 実行時間を計測するクラス
  *
@@ -41,99 +66,5249 @@ public:
     }
 
 private:
-    std::chrono::time_point<std::chrono::steady_clock> m_start_time; // 計測開始時刻
-    std::string m_mark;  // 計測対象のマーク（ラベル）
-};
+    std::chrono::time_point<std::chrono::steady_clock> m_start_time; // 計測開始時刻
+    std::string m_mark;  // 計測対象のマーク（ラベル）
+};
+
+/**
+ * @brief 開始時刻からの経過時間をミリ秒で返す
+ *
+ * CScopeProfiler では表せない、区間の累積や 1 件あたりの時間を求めるときに使います。
+ */
+inline double elapsed_milliseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// ===== ベンチマーク設定 =====
+// ベンチマーク全体で使用する設定値を構造体に集約
+struct BenchmarkConfig {
+    using DataType = int;  // テスト対象のデータ型
+    static constexpr size_t Size = 1000000;  // 配列の要素数
+    static constexpr size_t ReadingRepeat = 10;  // 読み取り回数
+    static constexpr size_t DisplayCount = 10;  // 表示する要素数
+    static constexpr DataType MinRandomValue = -100; // 生成する乱数の最小値
+    static constexpr DataType MaxRandomValue = 100;  // 生成する乱数の最大値
+    static constexpr size_t HistogramBuckets = 20;  // summarize で集計するヒストグラムのバケツ数
+    static constexpr size_t QuantileBuckets = 1024;  // 分位点推定用ヒストグラムのバケツ数
+    static constexpr size_t KllAccuracy = 200;       // KLL スケッチの精度パラメータ k
+    static constexpr size_t SearchQueries = 1000000;    // 二分探索系のクエリ数
+    static constexpr size_t LinearSearchQueries = 200;  // 線形探索（std::find）のクエリ数
+    static constexpr size_t QueueTargetDepth = 4096;     // キューシミュレーションで維持する深さ
+    static constexpr size_t QueueOperations = 1000000;   // キューシミュレーションの操作回数
+    static constexpr double QueuePushRatio = 0.5;        // 深さが目標付近のときに push を選ぶ確率
+    static constexpr size_t HandoffQueueCapacity = 1024;  // スレッド間受け渡しキューの容量（有界キュー）
+    static constexpr size_t HandoffMaxThreads = 4;        // 生産者・消費者それぞれの最大スレッド数
+    static constexpr size_t LatencySampleInterval = 64;   // 受け渡し遅延を計測する間隔（件）
+    static constexpr size_t ReadScalingMaxThreads = 8;    // 同時読み取りスケーリングの最大スレッド数
+    static constexpr size_t AccumulatorRepeat = 10;       // 部分和レイアウト比較で各スレッドが元データを走査する回数
+    static constexpr size_t ParallelGrain = 16384;        // 並列処理で 1 タスクが担当する要素数
+    static constexpr size_t UnevenListCount = 256;        // 不均一タスク用の list の本数（長さは Zipf 分布）
+    static constexpr size_t UnrolledChunkSize = 64;       // アンロールドリストの 1 ノードあたりの要素数
+    static constexpr size_t MiddleInsertCount = 1000;     // 中間挿入ベンチマークの挿入回数
+    static constexpr size_t BlockDequeRandomReads = 1000000;  // ブロックサイズ比較でのランダムアクセス回数
+    static constexpr size_t SmallContainerCount = 1000000;  // 小さなコンテナ比較で作るコンテナ数
+    static constexpr size_t SmallContainerMaxSize = 16;     // 小さなコンテナ 1 個あたりの最大要素数（0〜この値の一様分布）
+    static constexpr size_t SmallVectorInline = 8;          // CSmallVector のインライン容量（要素数）
+    static constexpr size_t RecordFields = 12;              // レコード型のフィールド数
+    static constexpr size_t ColonyBucketSize = 256;         // CColony の 1 バケツあたりのスロット数
+    static constexpr size_t ChurnCycles = 10;               // 削除・再挿入ベンチマークのサイクル数
+    static constexpr double ChurnFraction = 0.1;            // 1 サイクルで削除・再挿入する要素の割合
+    static constexpr size_t AssociativeKeys = 200000;       // 連想コンテナ比較で登録するキー数
+    static constexpr size_t AssociativeLookups = 1000000;   // 連想コンテナ比較の検索回数（ヒット・ミス半々）
+    static constexpr double RobinHoodMaxLoad = 0.875;       // CRobinHoodMap の最大負荷率
+    static constexpr size_t BTreeNodeBytes = 256;           // CBPlusTree の既定ノードサイズ（キャッシュライン 4 本分）
+    static constexpr size_t OrderedLookups = 1000000;       // 順序付きコンテナ比較の点検索回数（ヒット・ミス半々）
+    static constexpr size_t RangeScans = 10000;             // 範囲走査の回数
+    static constexpr size_t RangeScanWidth = 1000;          // 1 回の範囲走査で読む要素数
+    static constexpr size_t OrderedInserts = 100000;        // 順序付きコンテナ比較のランダム挿入件数
+    static constexpr size_t PriorityQueueSize = 1000000;        // 優先度キュー比較で最初に積むエントリ数
+    static constexpr size_t PriorityQueueOperations = 1000000;  // 優先度キュー比較の pop + push（hold 操作）の回数
+    static constexpr std::uint64_t DefaultSeed = 5489;  // 既定の乱数シード（std::mt19937 の既定値と同じ）
+    static constexpr size_t GenerateChunkSize = 1 << 20;  // generate サブコマンドで一度に書き出す要素数
+    static constexpr size_t StreamChunkBytes = 8 << 20;   // stream サブコマンドの既定チャンクサイズ（バイト）
+    static constexpr size_t PipelineBuffers = 4;          // パイプライン方式で循環させるチャンクバッファ数
+
+    /**
+     * @brief レイアウト比較（AoS / SoA）用の複数フィールドのレコード
+     */
+    struct Record {
+        std::array<DataType, RecordFields> fields;  // フィールド値
+    };
+};
+
+// ===== 実行時オプション =====
+// 実行するサブコマンド
+enum class Command {
+    Run,       // ベンチマークを実行
+    Generate,  // データセットファイルを書き出す
+    Stream,    // データセットファイルをチャンク単位で読みながら統計量を計算
+};
+
+// stream サブコマンドの読み込み方式
+enum class StreamIo {
+    All,   // すべての方式を順に計測
+    Read,  // read() でバッファへ読み込む
+    Mmap,  // ファイルの一部だけを mmap するウィンドウ方式
+    Pipeline,  // 読み込みスレッドと計算スレッドのダブルバッファ方式
+};
+
+// コマンドライン引数から決まる設定値をまとめる構造体
+struct RunOptions {
+    Command command = Command::Run;  // 実行するサブコマンド
+    std::uint64_t seed = BenchmarkConfig::DefaultSeed;  // 元データ生成に使う乱数シード
+    std::string input_path;   // 元データを読み込むファイル（空なら乱数で生成）/ stream の入力
+    std::string output_path;  // generate の出力先（拡張子 .npy なら NPY 形式、それ以外は raw）
+    size_t count = BenchmarkConfig::Size;  // generate で書き出す要素数
+    size_t chunk_bytes = BenchmarkConfig::StreamChunkBytes;  // stream のチャンクサイズ
+    StreamIo stream_io = StreamIo::All;  // stream の読み込み方式
+};
+
+// ===== ヘルパー関数群 =====
+/**
+ * @brief 64bit シードを MT19937 の 32bit シードへ畳み込む
+ *
+ * Rust 版 `Mt19937::reseed` と同じく `seed ^ (seed >> 32)` の下位 32bit を使用します。
+ */
+inline std::uint32_t fold_seed(std::uint64_t seed) {
+    return static_cast<std::uint32_t>(seed ^ (seed >> 32));
+}
+
+/**
+ * @brief MT19937 の出力を [min_val, max_val] の一様整数へ写像する
+ *
+ * `std::uniform_int_distribution` の写像は実装依存のため使用せず、Rust 版
+ * `Mt19937::next_i32_range` と同一の手順で変換します（両言語で同一データを得るための共通仕様）。
+ *  1. 64bit 値 = (1回目の出力 << 32) | 2回目の出力
+ *  2. span = max - min + 1、zone = (2^64 - 1) - ((2^64 - 1) % span)
+ *  3. 値 >= zone なら棄却して 1 へ戻り、そうでなければ min + (値 % span) を返す
+ */
+template<typename T>
+T draw_uniform_int(std::mt19937& engine, T min_val, T max_val) {
+    const auto span = static_cast<std::uint64_t>(static_cast<std::int64_t>(max_val) - static_cast<std::int64_t>(min_val) + 1);
+    constexpr std::uint64_t max_u64 = std::numeric_limits<std::uint64_t>::max();
+    const std::uint64_t zone = max_u64 - (max_u64 % span);
+    while (true) {
+        const std::uint64_t high = engine();  // 評価順を固定するため 2 回の呼び出しを分けて書く
+        const std::uint64_t low = engine();
+        const std::uint64_t value = (high << 32) | low;
+        if (value < zone) {
+            return static_cast<T>(static_cast<std::int64_t>(min_val) + static_cast<std::int64_t>(value % span));
+        }
+    }
+}
+
+/**
+ * @brief ベンチマークの元データとなる配列に乱数を格納する
+ * @tparam T 格納するデータの型
+ * @param src_array データを格納する配列（出力）
+ * @param min_val 乱数の最小値
+ * @param max_val 乱数の最大値
+ * @param seed 乱数シード（同じ値なら C++ / Rust で同一の配列になる）
+ */
+template<typename T>
+void generate_source_data(std::vector<T>& src_array, T min_val, T max_val, std::uint64_t seed) {
+    // ----- 乱数生成器の初期化 -----
+    std::mt19937 random_engine(fold_seed(seed));  // メルセンヌツイスタ乱数エンジン
+    // ----- 配列に乱数値を格納 -----
+    {
+        CScopeProfiler profiler("配列生成_乱数");
+        // 配列の各要素に乱数を格納
+        std::generate(src_array.begin(), src_array.end(), [&]() { return draw_uniform_int(random_engine, min_val, max_val); });
+    }
+}
+
+/**
+ * @brief データ列のチェックサム（FNV-1a 64bit）を計算する
+ *
+ * 各要素をリトルエンディアンのバイト列として順に投入します。
+ * Rust 版 `checksum` と同じ定義なので、両言語の元データが一致しているかを確認できます。
+ */
+template<typename Container>
+std::uint64_t checksum(const Container& container) {
+    using Unsigned = std::make_unsigned_t<typename Container::value_type>;
+    std::uint64_t hash = 0xcbf29ce484222325ULL;  // FNV offset basis
+    for (const auto& value : container) {
+        const auto bits = static_cast<Unsigned>(value);
+        for (size_t byte = 0; byte < sizeof(Unsigned); ++byte) {
+            hash ^= static_cast<std::uint64_t>((bits >> (8 * byte)) & 0xFFu);
+            hash *= 0x100000001b3ULL;  // FNV prime
+        }
+    }
+    return hash;
+}
+
+// ===== データセットファイル =====
+/**
+ * @brief 実行環境がリトルエンディアンかを判定する
+ *
+ * データセットファイルはリトルエンディアン固定のため、ゼロコピー読み込みや書き出しの可否判定に使います。
+ */
+inline bool is_little_endian() {
+    const std::uint16_t probe = 1;
+    unsigned char first_byte = 0;
+    std::memcpy(&first_byte, &probe, 1);
+    return first_byte == 1;
+}
+
+/**
+ * @brief 型 T に対応する NPY の dtype 記述子（例: int32 なら "<i4"）を返す
+ */
+template<typename T>
+std::string npy_descr() {
+    static_assert(std::is_integral_v<T>, "NPY 入出力は整数型のみ対応");
+    return std::string("<") + (std::is_signed_v<T> ? 'i' : 'u') + std::to_string(sizeof(T));
+}
+
+/**
+ * @brief 読み取り専用のメモリマップトファイル
+ *
+ * ファイル全体を `mmap` し、ページは参照時にオンデマンドで読み込まれます（10GB 超でも事前読み込み不要）。
+ * ムーブのみ可能で、デストラクタで `munmap` します。
+ */
+class CMappedFile final {
+public:
+    CMappedFile() = default;
+
+    /**
+     * @brief ファイルをマップする
+     * @param path 対象ファイルのパス
+     * @throws std::runtime_error オープンやマップに失敗した場合
+     */
+    explicit CMappedFile(const std::string& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("ファイルを開けません: " + path + " (" + std::strerror(errno) + ")");
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            const int err = errno;
+            ::close(fd);
+            throw std::runtime_error("ファイル情報を取得できません: " + path + " (" + std::strerror(err) + ")");
+        }
+        m_size = static_cast<size_t>(st.st_size);
+        if (m_size > 0) {
+            void* addr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                const int err = errno;
+                ::close(fd);
+                throw std::runtime_error("mmap に失敗しました: " + path + " (" + std::strerror(err) + ")");
+            }
+            m_addr = addr;
+            // 先頭から順に読む用途なので先読みを積極的に行わせる（失敗しても動作には影響しない）
+            ::madvise(m_addr, m_size, MADV_SEQUENTIAL);
+        }
+        // マップは fd を閉じても有効
+        ::close(fd);
+    }
+
+    ~CMappedFile() {
+        if (m_addr != nullptr) {
+            ::munmap(m_addr, m_size);
+        }
+    }
+
+    CMappedFile(const CMappedFile&) = delete;
+    CMappedFile& operator=(const CMappedFile&) = delete;
+
+    CMappedFile(CMappedFile&& other) noexcept
+        : m_addr(std::exchange(other.m_addr, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+    CMappedFile& operator=(CMappedFile&& other) noexcept {
+        if (this != &other) {
+            if (m_addr != nullptr) {
+                ::munmap(m_addr, m_size);
+            }
+            m_addr = std::exchange(other.m_addr, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+        }
+        return *this;
+    }
+
+    const unsigned char* data() const { return static_cast<const unsigned char*>(m_addr); }
+    size_t size() const { return m_size; }
+
+private:
+    void* m_addr = nullptr;  // マップ先アドレス（空ファイルなら nullptr）
+    size_t m_size = 0;       // マップしたバイト数
+};
+
+/**
+ * @brief NPY ヘッダの解析結果
+ */
+struct NpyHeader {
+    std::string descr;      // dtype 記述子（例: "<i4"）
+    size_t count = 0;       // 要素数（shape の総積）
+    size_t data_offset = 0; // ファイル先頭からデータ部までのバイト数
+};
+
+/**
+ * @brief NPY (v1.0 / v2.0 / v3.0) のヘッダを解析する
+ *
+ * C 順序の数値配列のみ受け付け、多次元 shape は総要素数として平坦化します。
+ * @throws std::runtime_error 形式が不正、または Fortran 順序の場合
+ */
+inline NpyHeader parse_npy_header(const unsigned char* bytes, size_t size) {
+    static constexpr unsigned char Magic[] = {0x93, 'N', 'U', 'M', 'P', 'Y'};
+    if (size < 10 || std::memcmp(bytes, Magic, sizeof(Magic)) != 0) {
+        throw std::runtime_error("NPY のマジックナンバーが一致しません");
+    }
+    const unsigned major = bytes[6];
+    size_t header_len = 0;
+    size_t prefix = 0;
+    if (major == 1) {
+        header_len = bytes[8] | (static_cast<size_t>(bytes[9]) << 8);
+        prefix = 10;
+    } else if (major == 2 || major == 3) {
+        if (size < 12) {
+            throw std::runtime_error("NPY ヘッダが途中で終わっています");
+        }
+        header_len = bytes[8] | (static_cast<size_t>(bytes[9]) << 8) | (static_cast<size_t>(bytes[10]) << 16) |
+                     (static_cast<size_t>(bytes[11]) << 24);
+        prefix = 12;
+    } else {
+        throw std::runtime_error("未対応の NPY バージョンです: " + std::to_string(major));
+    }
+    if (prefix + header_len > size) {
+        throw std::runtime_error("NPY ヘッダが途中で終わっています");
+    }
+    const std::string header(reinterpret_cast<const char*>(bytes + prefix), header_len);
+
+    // ----- 'key': 以降の値文字列を取り出すラムダ -----
+    auto value_of = [&](const std::string& key) {
+        const auto key_pos = header.find("'" + key + "'");
+        if (key_pos == std::string::npos) {
+            throw std::runtime_error("NPY ヘッダに " + key + " がありません");
+        }
+        const auto colon = header.find(':', key_pos);
+        return header.substr(colon + 1);
+    };
+
+    NpyHeader result;
+    const std::string descr_field = value_of("descr");
+    const auto quote_begin = descr_field.find('\'');
+    const auto quote_end = descr_field.find('\'', quote_begin + 1);
+    if (quote_begin == std::string::npos || quote_end == std::string::npos) {
+        throw std::runtime_error("NPY の descr を解析できません");
+    }
+    result.descr = descr_field.substr(quote_begin + 1, quote_end - quote_begin - 1);
+
+    const std::string order_field = value_of("fortran_order");
+    const auto order_begin = order_field.find_first_not_of(' ');
+    if (order_begin == std::string::npos || order_field.compare(order_begin, 5, "False") != 0) {
+        throw std::runtime_error("Fortran 順序の NPY には対応していません");
+    }
+
+    const std::string shape_field = value_of("shape");
+    const auto paren_begin = shape_field.find('(');
+    const auto paren_end = shape_field.find(')');
+    if (paren_begin == std::string::npos || paren_end == std::string::npos) {
+        throw std::runtime_error("NPY の shape を解析できません");
+    }
+    result.count = 1;  // shape が () のときはスカラー 1 要素
+    size_t dim = 0;
+    bool in_number = false;
+    for (size_t i = paren_begin + 1; i <= paren_end; ++i) {
+        const char c = shape_field[i];
+        if (c >= '0' && c <= '9') {
+            dim = dim * 10 + static_cast<size_t>(c - '0');
+            in_number = true;
+        } else if (in_number) {
+            result.count *= dim;
+            dim = 0;
+            in_number = false;
+        }
+    }
+    result.data_offset = prefix + header_len;
+    return result;
+}
+
+/**
+ * @brief NPY v1.0 のヘッダを書き出す
+ *
+ * データ部の開始位置が 64 バイト境界になるよう空白でパディングします（ゼロコピー読み込みの前提）。
+ */
+template<typename T>
+void write_npy_header(std::ostream& out, size_t count) {
+    std::string header = "{'descr': '" + npy_descr<T>() + "', 'fortran_order': False, 'shape': (" + std::to_string(count) + ",), }";
+    const size_t prefix = 10;
+    const size_t total = (prefix + header.size() + 1 + 63) / 64 * 64;
+    header.append(total - prefix - header.size() - 1, ' ');
+    header.push_back('\n');
+    const unsigned char preamble[] = {0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0,
+                                      static_cast<unsigned char>(header.size() & 0xFF),
+                                      static_cast<unsigned char>(header.size() >> 8)};
+    out.write(reinterpret_cast<const char*>(preamble), sizeof(preamble));
+    out << header;
+}
+
+/**
+ * @brief パスの拡張子が .npy かを判定する
+ */
+inline bool has_npy_extension(const std::string& path) {
+    const std::string ext = ".npy";
+    return path.size() >= ext.size() && path.compare(path.size() - ext.size(), ext.size(), ext) == 0;
+}
+
+/**
+ * @brief 乱数データセットをファイルへ書き出す（generate サブコマンド）
+ *
+ * `GenerateChunkSize` 要素ずつ生成・書き出しするため、メモリに載らない件数でも生成できます。
+ * 同じシードなら `run` 時にメモリ上で生成する元データと同一の内容になります。
+ * @param path 出力先（拡張子 .npy なら NPY v1.0、それ以外はヘッダなしの raw リトルエンディアン）
+ * @param count 要素数
+ * @param seed 乱数シード
+ */
+inline void write_dataset(const std::string& path, size_t count, std::uint64_t seed) {
+    using T = BenchmarkConfig::DataType;
+    if (!is_little_endian()) {
+        throw std::runtime_error("ビッグエンディアン環境でのデータセット書き出しには対応していません");
+    }
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("出力ファイルを開けません: " + path);
+    }
+    if (has_npy_extension(path)) {
+        write_npy_header<T>(out, count);
+    }
+    std::mt19937 random_engine(fold_seed(seed));
+    std::vector<T> chunk(std::min(count, BenchmarkConfig::GenerateChunkSize));
+    for (size_t written = 0; written < count;) {
+        const size_t n = std::min(chunk.size(), count - written);
+        std::generate_n(chunk.begin(), n, [&]() {
+            return draw_uniform_int(random_engine, BenchmarkConfig::MinRandomValue, BenchmarkConfig::MaxRandomValue);
+        });
+        out.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(n * sizeof(T)));
+        written += n;
+    }
+    out.flush();
+    if (!out) {
+        throw std::runtime_error("書き込みに失敗しました: " + path);
+    }
+}
+
+/**
+ * @brief ベンチマークの元データ
+ *
+ * 乱数生成したメモリ上の配列、またはメモリマップしたデータセットファイルのどちらかを保持し、
+ * 読み取り専用のコンテナとして公開します。ファイルの dtype が `DataType` と一致しアライメントも
+ * 満たす場合はマップ領域を直接参照し（ゼロコピー）、そうでなければ変換しながらコピーします。
+ */
+class CSourceData final {
+public:
+    using value_type = BenchmarkConfig::DataType;
+    using const_iterator = const value_type*;
+
+    /**
+     * @brief 乱数で元データを生成する
+     */
+    static CSourceData generate(size_t count, std::uint64_t seed) {
+        CSourceData source;
+        source.m_owned.resize(count);
+        generate_source_data(source.m_owned, BenchmarkConfig::MinRandomValue, BenchmarkConfig::MaxRandomValue, seed);
+        source.m_data = source.m_owned.data();
+        source.m_size = source.m_owned.size();
+        return source;
+    }
+
+    /**
+     * @brief raw (.bin 等) または .npy ファイルから元データを読み込む
+     * @throws std::runtime_error ファイル形式が不正な場合
+     */
+    static CSourceData load(const std::string& path) {
+        CSourceData source;
+        source.m_mapping = CMappedFile(path);
+        const unsigned char* bytes = source.m_mapping.data();
+        const size_t size = source.m_mapping.size();
+
+        NpyHeader header;
+        if (has_npy_extension(path)) {
+            header = parse_npy_header(bytes, size);
+        } else {
+            // raw 形式: ヘッダなしの DataType 配列（リトルエンディアン）
+            if (size % sizeof(value_type) != 0) {
+                throw std::runtime_error("raw ファイルのサイズが要素サイズの倍数ではありません: " + path);
+            }
+            header.descr = npy_descr<value_type>();
+            header.count = size / sizeof(value_type);
+        }
+        source.adopt(header, path);
+        return source;
+    }
+
+    const_iterator begin() const { return m_data; }
+    const_iterator end() const { return m_data + m_size; }
+    const value_type* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    // マップ領域を直接参照しているか
+    bool is_zero_copy() const { return m_size > 0 && m_owned.empty(); }
+
+private:
+    CSourceData() = default;
+
+    /**
+     * @brief マップ済みファイルのデータ部を参照（またはコピー）する
+     */
+    void adopt(const NpyHeader& header, const std::string& path) {
+        const unsigned char* bytes = m_mapping.data() + header.data_offset;
+        const size_t available = m_mapping.size() - header.data_offset;
+        if (header.descr.size() < 3 || (header.descr[0] != '<' && header.descr[0] != '|') ||
+            (header.descr[1] != 'i' && header.descr[1] != 'u')) {
+            throw std::runtime_error("未対応の dtype です（リトルエンディアン整数のみ対応）: " + header.descr);
+        }
+        const bool is_signed = header.descr[1] == 'i';
+        const size_t width = std::stoul(header.descr.substr(2));
+        if (width != 1 && width != 2 && width != 4 && width != 8) {
+            throw std::runtime_error("未対応の dtype です: " + header.descr);
+        }
+        if (header.count > available / width) {
+            throw std::runtime_error("ファイルが shape に対して短すぎます: " + path);
+        }
+
+        // ----- ゼロコピー: 型・エンディアン・アライメントがすべて一致 -----
+        const bool same_type = width == sizeof(value_type) && is_signed == std::is_signed_v<value_type>;
+        if (same_type && is_little_endian() && reinterpret_cast<std::uintptr_t>(bytes) % alignof(value_type) == 0) {
+            m_data = reinterpret_cast<const value_type*>(bytes);
+            m_size = header.count;
+            return;
+        }
+
+        // ----- 変換コピー: 範囲外の値はエラー -----
+        m_owned.resize(header.count);
+        for (size_t i = 0; i < header.count; ++i) {
+            std::uint64_t raw = 0;
+            for (size_t b = 0; b < width; ++b) {
+                raw |= static_cast<std::uint64_t>(bytes[i * width + b]) << (8 * b);
+            }
+            // 符号付きは符号拡張してから範囲を確認する
+            const unsigned shift = static_cast<unsigned>(64 - 8 * width);
+            const std::int64_t as_signed = static_cast<std::int64_t>(raw << shift) >> shift;
+            const bool in_range =
+                is_signed ? (as_signed >= static_cast<std::int64_t>(std::numeric_limits<value_type>::min()) &&
+                             as_signed <= static_cast<std::int64_t>(std::numeric_limits<value_type>::max()))
+                          : raw <= static_cast<std::uint64_t>(std::numeric_limits<value_type>::max());
+            if (!in_range) {
+                throw std::runtime_error("DataType の範囲外の値があります（要素 " + std::to_string(i) + "）: " + path);
+            }
+            m_owned[i] = static_cast<value_type>(is_signed ? as_signed : static_cast<std::int64_t>(raw));
+        }
+        m_data = m_owned.data();
+        m_size = m_owned.size();
+        m_mapping = CMappedFile();  // コピー済みなのでマップは不要
+    }
+
+    std::vector<value_type> m_owned;  // 生成または変換コピーしたデータ
+    CMappedFile m_mapping;            // ゼロコピー時に参照するマップ
+    const value_type* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+/**
+ * @brief コンテナのデータを指定回数（ReadingRepeat）読み取る関数
+ *
+ * 注意:
+ * 単純に要素を読み取るだけのループは、コンパイラの最適化（デッドコード削除）によって
+ * 処理全体が削除されてしまう可能性があります。
+ * これを防ぎ、確実に読み取り処理を実行させるため、読み取った値を`volatile`修飾子を
+ * 付けた変数(`sink`)に代入しています。`volatile`変数へのアクセスは、コンパイラが
+ * 無視できない副作用と見なすため、ループが維持され、純粋な読み取り性能を計測できます。
+ * 複数スレッドから同じコンテナに対して同時に呼び出しても安全です（読み取りのみ）。
+ */
+template<typename Container>
+void read_container(const Container& container) {
+    volatile typename Container::value_type sink{};
+    for (size_t n = 0; n < BenchmarkConfig::ReadingRepeat; ++n) {
+        for (const auto& element : container) {
+            sink = element;
+        }
+    }
+    (void)sink; // sinkが未使用であるというコンパイラ警告を抑制
+}
+
+/**
+ * @brief コンテナの先頭n個の要素を出力する関数
+ *
+ * @tparam Container コンテナの型
+ * @param container 対象のコンテナ
+ * @param n 表示する要素数
+ * @param container_name コンテナの名前（表示用）
+ */
+template <typename Container>
+void print_first_n_elements(const Container& container, size_t n, const std::string& container_name) {
+    std::cout << container_name << ": ";
+    // コンテナの要素数より多く表示しようとするのを防ぐ
+    size_t elements_to_print = std::min(n, container.size());
+    // STLアルゴリズムを使い、ループを明示的に書かずに出力する
+    std::copy_n(container.begin(), elements_to_print, std::ostream_iterator<typename Container::value_type>(std::cout, " "));
+    std::cout << std::endl;
+}
+
+/**
+ * @brief 平均値を double 累積で計算する汎用版
+ *
+ * 要素ごとに double へ変換して加算するため、整数型では変換と浮動小数点加算の依存連鎖が発生します。
+ */
+template<typename Container>
+double average_floating(const Container& container) {
+    if (container.empty()) {
+        return 0.0;
+    }
+    const double sum = std::accumulate(container.begin(), container.end(), 0.0);
+    return sum / static_cast<double>(container.size());
+}
+
+__extension__ using Int128 = __int128;  // 桁あふれし得る整数合計の累積型（GCC / Clang 拡張）
+
+/**
+ * @brief コンテナの平均値を計算して返すヘルパー関数
+ *
+ * 整数型はコンパイル時に分岐し、合計を整数で正確に累積してから最後に 1 回だけ double へ変換します
+ * （連続領域ではベクトル化される）。要素数 × 型の絶対値上限が int64 に収まる場合は int64、
+ * 収まらない可能性がある場合（64bit 型や 2^31 要素超）は 128bit 整数で累積します。
+ * 浮動小数点型は `average_floating()` と同じです。
+ */
+template<typename Container>
+double average(const Container& container) {
+    using T = typename Container::value_type;
+    if constexpr (std::is_integral_v<T>) {
+        if (container.empty()) {
+            return 0.0;
+        }
+        // 1 要素の絶対値の上限（64bit 型では int64 に 1 要素すら安全に収まらない扱い）
+        constexpr std::uint64_t magnitude = sizeof(T) >= 8 ? std::numeric_limits<std::uint64_t>::max() : std::uint64_t{1} << (8 * sizeof(T));
+        constexpr std::uint64_t int64_safe_count = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) / magnitude;
+        const double count = static_cast<double>(container.size());
+        if (container.size() <= int64_safe_count) {
+            return static_cast<double>(std::accumulate(container.begin(), container.end(), std::int64_t{0})) / count;
+        }
+        return static_cast<double>(std::accumulate(container.begin(), container.end(), Int128{0})) / count;
+    } else {
+        return average_floating(container);
+    }
+}
+
+/**
+ * @brief Welford法の途中状態（件数・平均・偏差平方和）
+ *
+ * `add` で 1 要素ずつ更新し、`merge` で別区間の状態と結合できます（Chan らの並列版の式）。
+ * チャンク単位やスレッド単位で部分状態を作り、最後に結合する用途を想定しています。
+ */
+struct WelfordState {
+    double count = 0.0;  // 要素数
+    double mean = 0.0;   // 平均
+    double m2 = 0.0;     // 平均からの偏差平方和
+
+    /**
+     * @brief 1 要素を追加する
+     */
+    void add(double x) {
+        count += 1.0;
+        const double delta = x - mean;
+        mean += delta / count;
+        m2 += delta * (x - mean);
+    }
+
+    /**
+     * @brief 別区間の状態を結合する
+     */
+    void merge(const WelfordState& other) {
+        if (other.count == 0.0) {
+            return;
+        }
+        if (count == 0.0) {
+            *this = other;
+            return;
+        }
+        const double total = count + other.count;
+        const double delta = other.mean - mean;
+        mean += delta * (other.count / total);
+        m2 += other.m2 + delta * delta * (count * other.count / total);
+        count = total;
+    }
+
+    /**
+     * @brief 母分散を返す（空なら 0.0）
+     */
+    double variance() const {
+        return count == 0.0 ? 0.0 : m2 / count;
+    }
+};
+
+/**
+ * @brief 範囲 [first, last) を Welford 状態へ畳み込む
+ */
+template<typename Iterator>
+WelfordState welford_fold(Iterator first, Iterator last) {
+    WelfordState state;
+    for (; first != last; ++first) {
+        state.add(static_cast<double>(*first));
+    }
+    return state;
+}
+
+/**
+ * @brief コンテナの分散を計算して返すヘルパー関数
+ *
+ * Welford法（1パス・数値安定）で母分散を計算します。
+ * 空コンテナは 0.0 を返します。サンプル分散が必要な場合は
+ * `M2 / (n - 1)` に変更してください（n >= 2 前提）。
+ */
+template<typename Container>
+double variance(const Container& container) {
+    // Welford法: 1パスで母分散を算出（population variance）
+    return welford_fold(container.begin(), container.end()).variance();
+}
+
+/**
+ * @brief 範囲 [low, high) を等幅バケツに分けたヒストグラム
+ *
+ * 範囲外の値は先頭または末尾のバケツに丸めて数えます。整数データは `make_observed_histogram()` のように
+ * high を最大値 + 1 にすると、最大値だけが末尾のバケツに余分に入ることがありません。
+ */
+struct FixedHistogram {
+    double low = 0.0;             // 範囲の下限
+    double high = 0.0;            // 範囲の上限
+    std::vector<size_t> counts;   // 各バケツの件数
+
+    FixedHistogram(double low_value, double high_value, size_t buckets)
+        : low(low_value), high(high_value), counts(buckets, 0),
+          m_scale(high_value > low_value ? static_cast<double>(buckets) / (high_value - low_value) : 0.0) {
+        if (buckets == 0) {
+            throw std::invalid_argument("ヒストグラムのバケツ数は 1 以上が必要です");
+        }
+    }
+
+    /**
+     * @brief 1 要素を数える
+     */
+    void add(double x) {
+        const double position = (x - low) * m_scale;
+        const size_t last = counts.size() - 1;
+        const size_t index = position <= 0.0 ? 0 : std::min(static_cast<size_t>(position), last);
+        ++counts[index];
+    }
+
+    /**
+     * @brief 分位点を近似する（該当バケツ内は一様分布とみなして線形補間）
+     * @param q 分位（0.0〜1.0）
+     */
+    double quantile(double q) const {
+        const size_t total = std::accumulate(counts.begin(), counts.end(), size_t{0});
+        if (total == 0) {
+            return low;
+        }
+        const double target = q * static_cast<double>(total);
+        const double width = (high - low) / static_cast<double>(counts.size());
+        double cumulative = 0.0;
+        for (size_t i = 0; i < counts.size(); ++i) {
+            const double next = cumulative + static_cast<double>(counts[i]);
+            if (next >= target && counts[i] > 0) {
+                return low + width * (static_cast<double>(i) + (target - cumulative) / static_cast<double>(counts[i]));
+            }
+            cumulative = next;
+        }
+        return high;
+    }
+
+private:
+    double m_scale;  // 値からバケツ番号への倍率
+};
+
+/**
+ * @brief コンテナの実際の最小値・最大値を範囲とする FixedHistogram を作る
+ *
+ * 固定バケツは値の範囲が既知である前提なので、`--input` のデータでも全要素が範囲内に収まるよう
+ * 事前に 1 回走査して範囲を決めます。空のコンテナでは [0, 1) になります。
+ */
+template<typename Container>
+FixedHistogram make_observed_histogram(const Container& container, size_t buckets) {
+    using T = typename Container::value_type;
+    if (container.empty()) {
+        return FixedHistogram(0.0, 1.0, buckets);
+    }
+    const auto [min_it, max_it] = std::minmax_element(container.begin(), container.end());
+    const double high = std::is_integral_v<T> ? static_cast<double>(*max_it) + 1.0
+                                              : std::nextafter(static_cast<double>(*max_it), std::numeric_limits<double>::infinity());
+    return FixedHistogram(static_cast<double>(*min_it), high, buckets);
+}
+
+/**
+ * @brief summarize の結果（1 パスで求めた統計量一式）
+ */
+template<typename T>
+struct Summary {
+    size_t count = 0;       // 要素数
+    double sum = 0.0;       // 合計
+    double mean = 0.0;      // 平均（sum / count）
+    double variance = 0.0;  // 母分散（Welford法）
+    T min{};                // 最小値
+    T max{};                // 最大値
+    std::optional<FixedHistogram> histogram;  // 要求された場合のみ集計
+};
+
+/**
+ * @brief 件数・合計・平均・分散・最小・最大（と任意でヒストグラム）を 1 回の走査で求める
+ *
+ * `average()` と `variance()` を個別に呼ぶと走査が 2 回になり、list では 2 回ともポインタ追跡になります。
+ * @param histogram 指定した場合は同じ走査でヒストグラムも集計する（空なら集計しない）
+ */
+template<typename Container>
+Summary<typename Container::value_type> summarize(const Container& container, std::optional<FixedHistogram> histogram = std::nullopt) {
+    using T = typename Container::value_type;
+    Summary<T> summary;
+    summary.histogram = std::move(histogram);
+    if (container.empty()) {
+        return summary;
+    }
+    WelfordState state;
+    double sum = 0.0;
+    T min_value = *container.begin();
+    T max_value = min_value;
+    FixedHistogram* hist = summary.histogram ? &*summary.histogram : nullptr;
+    for (const auto& value : container) {
+        const double x = static_cast<double>(value);
+        sum += x;
+        state.add(x);
+        min_value = std::min(min_value, value);
+        max_value = std::max(max_value, value);
+        if (hist != nullptr) {
+            hist->add(x);
+        }
+    }
+    summary.count = static_cast<size_t>(state.count);
+    summary.sum = sum;
+    summary.mean = sum / state.count;
+    summary.variance = state.variance();
+    summary.min = min_value;
+    summary.max = max_value;
+    return summary;
+}
+
+/**
+ * @brief 分位点を厳密に求める（作業用コピー + std::nth_element）
+ *
+ * コンテナは変更せず、要素を連続領域へコピーしてから部分選択します（ソート不要で平均 O(N)）。
+ * 位置 q * (N - 1) が整数でない場合は前後の順位の値を線形補間します（q = 0.5 で通常の中央値）。
+ * @param scratch 作業用バッファ（呼び出し間で再利用してアロケーションを避ける）
+ */
+template<typename Container>
+double quantile_exact(const Container& container, double q, std::vector<typename Container::value_type>& scratch) {
+    if (container.empty()) {
+        return 0.0;
+    }
+    scratch.assign(container.begin(), container.end());
+    const double position = q * static_cast<double>(scratch.size() - 1);
+    const auto lower = static_cast<size_t>(position);
+    const double fraction = position - static_cast<double>(lower);
+    std::nth_element(scratch.begin(), scratch.begin() + static_cast<std::ptrdiff_t>(lower), scratch.end());
+    const double lower_value = static_cast<double>(scratch[lower]);
+    if (fraction == 0.0 || lower + 1 >= scratch.size()) {
+        return lower_value;
+    }
+    // nth_element 後は lower より後ろがすべて lower 以上なので、その最小値が次の順位
+    const double upper_value = static_cast<double>(*std::min_element(scratch.begin() + static_cast<std::ptrdiff_t>(lower) + 1, scratch.end()));
+    return lower_value + (upper_value - lower_value) * fraction;
+}
+
+/**
+ * @brief 百分位数（最近傍順位）を返す（values は並べ替えられる）
+ */
+inline std::int64_t percentile(std::vector<std::int64_t>& values, double q) {
+    if (values.empty()) {
+        return 0;
+    }
+    const auto rank = static_cast<size_t>(q * static_cast<double>(values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(rank), values.end());
+    return values[rank];
+}
+
+/**
+ * @brief KLL 分位点スケッチ（Karnin, Lang, Liberty 2016）
+ *
+ * レベル h の要素は重み 2^h を表し、各レベルが容量を超えるとソートして 1 つおき（開始位置は乱数）に
+ * 上位レベルへ昇格させます。保持要素数は O(k) 程度に抑えられ、任意のイテレータから 1 パスで構築できます。
+ * 乱数は固定シードなので、同じ入力なら同じ結果になります。
+ */
+template<typename T>
+class CKllSketch final {
+public:
+    /**
+     * @param k 精度パラメータ（大きいほど高精度・大容量。誤差はおおよそ 1.65 / k）
+     */
+    explicit CKllSketch(size_t k = BenchmarkConfig::KllAccuracy) : m_k(k), m_random_engine(fold_seed(BenchmarkConfig::DefaultSeed)) {
+        grow();
+    }
+
+    /**
+     * @brief 1 要素を追加する
+     */
+    void add(const T& value) {
+        m_levels[0].push_back(value);
+        ++m_retained;
+        ++m_count;
+        if (m_retained >= m_max_retained) {
+            compress();
+        }
+    }
+
+    /**
+     * @brief 分位点を推定する
+     * @param q 分位（0.0〜1.0）
+     */
+    double quantile(double q) const {
+        if (m_count == 0) {
+            return 0.0;
+        }
+        std::vector<std::pair<T, std::uint64_t>> weighted;
+        weighted.reserve(m_retained);
+        for (size_t h = 0; h < m_levels.size(); ++h) {
+            for (const T& value : m_levels[h]) {
+                weighted.emplace_back(value, std::uint64_t{1} << h);
+            }
+        }
+        std::sort(weighted.begin(), weighted.end());
+        std::uint64_t total = 0;
+        for (const auto& item : weighted) {
+            total += item.second;
+        }
+        const double target = q * static_cast<double>(total);
+        std::uint64_t cumulative = 0;
+        for (const auto& item : weighted) {
+            cumulative += item.second;
+            if (static_cast<double>(cumulative) >= target) {
+                return static_cast<double>(item.first);
+            }
+        }
+        return static_cast<double>(weighted.back().first);
+    }
+
+    size_t count() const { return m_count; }
+    size_t retained() const { return m_retained; }
+
+    /**
+     * @brief 保持しているバッファの確保済みバイト数
+     */
+    size_t memory_bytes() const {
+        size_t bytes = sizeof(*this);
+        for (const auto& level : m_levels) {
+            bytes += level.capacity() * sizeof(T);
+        }
+        return bytes;
+    }
+
+private:
+    /**
+     * @brief レベル h の容量（上位ほど大きく、下位は 2/3 倍ずつ小さくなる）
+     */
+    size_t capacity(size_t h) const {
+        const double depth = static_cast<double>(m_levels.size() - h - 1);
+        return static_cast<size_t>(std::ceil(static_cast<double>(m_k) * std::pow(2.0 / 3.0, depth))) + 1;
+    }
+
+    /**
+     * @brief 最上位にレベルを追加し、総容量を更新する
+     */
+    void grow() {
+        m_levels.emplace_back();
+        m_max_retained = 0;
+        for (size_t h = 0; h < m_levels.size(); ++h) {
+            m_max_retained += capacity(h);
+        }
+    }
+
+    /**
+     * @brief 容量を超えた最下位のレベルを 1 つ圧縮する
+     */
+    void compress() {
+        for (size_t h = 0; h < m_levels.size(); ++h) {
+            if (m_levels[h].size() >= capacity(h)) {
+                if (h + 1 >= m_levels.size()) {
+                    grow();
+                }
+                auto& level = m_levels[h];
+                std::sort(level.begin(), level.end());
+                // 奇数個なら末尾 1 個は残し、残りの半分を上位へ昇格させる
+                const size_t paired = level.size() & ~size_t{1};
+                const size_t offset = m_random_engine() & 1u;
+                auto& upper = m_levels[h + 1];
+                for (size_t i = offset; i < paired; i += 2) {
+                    upper.push_back(level[i]);
+                }
+                level.erase(level.begin(), level.begin() + static_cast<std::ptrdiff_t>(paired));
+                m_retained -= paired / 2;
+                return;
+            }
+        }
+    }
+
+    size_t m_k;                               // 精度パラメータ
+    std::vector<std::vector<T>> m_levels;     // レベルごとの保持要素
+    size_t m_retained = 0;                    // 保持要素の総数
+    size_t m_max_retained = 0;                // 圧縮を始める保持要素数
+    size_t m_count = 0;                       // 追加された要素数
+    std::mt19937 m_random_engine;             // 昇格位置を選ぶ乱数
+};
+
+// ===== 固定容量リングバッファ =====
+/**
+ * @brief 容量固定（2 のべき乗）のリングバッファコンテナ
+ *
+ * 連続領域に要素を置き、論理位置 i の要素を `(先頭 + i) & (容量 - 1)` で参照します。
+ * deque のようなブロック管理を持たず、両端の追加・削除は添字の更新だけで済みます。
+ * 容量はコンストラクタで決まり（2 のべき乗に切り上げ）、満杯での追加は std::length_error を送出します。
+ * イテレータはランダムアクセスなので、std::sort や std::lower_bound もそのまま使えます。
+ */
+template<typename T>
+class CRingBuffer final {
+    /**
+     * @brief 論理位置を保持するランダムアクセスイテレータ
+     */
+    template<bool IsConst>
+    class Iterator final {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using Owner = std::conditional_t<IsConst, const CRingBuffer, CRingBuffer>;
+
+        Iterator() = default;
+        Iterator(Owner* owner, size_t index) : m_owner(owner), m_index(index) {}
+        // 非 const から const への変換
+        template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        Iterator(const Iterator<OtherConst>& other) : m_owner(other.m_owner), m_index(other.m_index) {}
+
+        reference operator*() const { return (*m_owner)[m_index]; }
+        pointer operator->() const { return &(*m_owner)[m_index]; }
+        reference operator[](difference_type n) const { return (*m_owner)[m_index + static_cast<size_t>(n)]; }
+
+        Iterator& operator++() { ++m_index; return *this; }
+        Iterator operator++(int) { Iterator old = *this; ++m_index; return old; }
+        Iterator& operator--() { --m_index; return *this; }
+        Iterator operator--(int) { Iterator old = *this; --m_index; return old; }
+        Iterator& operator+=(difference_type n) { m_index += static_cast<size_t>(n); return *this; }
+        Iterator& operator-=(difference_type n) { m_index -= static_cast<size_t>(n); return *this; }
+        friend Iterator operator+(Iterator it, difference_type n) { return it += n; }
+        friend Iterator operator+(difference_type n, Iterator it) { return it += n; }
+        friend Iterator operator-(Iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const Iterator& a, const Iterator& b) {
+            return static_cast<difference_type>(a.m_index) - static_cast<difference_type>(b.m_index);
+        }
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.m_index == b.m_index; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.m_index != b.m_index; }
+        friend bool operator<(const Iterator& a, const Iterator& b) { return a.m_index < b.m_index; }
+        friend bool operator>(const Iterator& a, const Iterator& b) { return a.m_index > b.m_index; }
+        friend bool operator<=(const Iterator& a, const Iterator& b) { return a.m_index <= b.m_index; }
+        friend bool operator>=(const Iterator& a, const Iterator& b) { return a.m_index >= b.m_index; }
+
+    private:
+        friend class Iterator<!IsConst>;
+        Owner* m_owner = nullptr;  // 対象のリングバッファ
+        size_t m_index = 0;        // 論理位置（先頭からの距離）
+    };
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    /**
+     * @param capacity 最低限必要な容量（2 のべき乗に切り上げる）
+     */
+    explicit CRingBuffer(size_t capacity = 0) {
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        m_slots.resize(rounded);
+        m_mask = rounded - 1;
+    }
+
+    /**
+     * @brief [first, last) の要素数を容量として、その要素で満たした状態で構築する
+     *
+     * 要素を先に書き込んでから残りの領域を確保するので、書き込む範囲のゼロクリアは行いません。
+     */
+    template<typename ForwardIt, typename = std::enable_if_t<!std::is_integral_v<ForwardIt>>>
+    CRingBuffer(ForwardIt first, ForwardIt last) {
+        const auto count = static_cast<size_t>(std::distance(first, last));
+        size_t rounded = 1;
+        while (rounded < count) {
+            rounded <<= 1;
+        }
+        m_slots.reserve(rounded);
+        m_slots.assign(first, last);
+        m_slots.resize(rounded);
+        m_mask = rounded - 1;
+        m_size = count;
+    }
+
+    /**
+     * @brief 内容を [first, last) で置き換える（容量は変えず、超える場合は std::length_error）
+     */
+    template<typename ForwardIt>
+    void assign(ForwardIt first, ForwardIt last) {
+        clear();
+        insert(end(), first, last);
+    }
+
+    /**
+     * @brief pos の直前に [first, last) を挿入し、挿入した先頭要素を指すイテレータを返す
+     *
+     * pos 以降の要素を後ろへずらしてから、物理的に連続した最大 2 区間へまとめてコピーします。
+     * 容量を超える場合は std::length_error を送出します。
+     */
+    template<typename ForwardIt>
+    iterator insert(const_iterator pos, ForwardIt first, ForwardIt last) {
+        const auto index = static_cast<size_t>(pos - const_iterator(begin()));
+        const auto count = static_cast<size_t>(std::distance(first, last));
+        if (count > capacity() - m_size) {
+            throw std::length_error("CRingBuffer の容量を超えて追加しようとしました");
+        }
+        const size_t old_size = m_size;
+        m_size += count;
+        std::move_backward(begin() + static_cast<std::ptrdiff_t>(index), begin() + static_cast<std::ptrdiff_t>(old_size), end());
+        const size_t start = (m_head + index) & m_mask;
+        const size_t head_part = std::min(count, m_slots.size() - start);
+        const ForwardIt middle = std::next(first, static_cast<std::ptrdiff_t>(head_part));
+        std::copy(first, middle, m_slots.begin() + static_cast<std::ptrdiff_t>(start));
+        std::copy(middle, last, m_slots.begin());
+        return begin() + static_cast<std::ptrdiff_t>(index);
+    }
+
+    void push_back(const T& value) {
+        check_not_full();
+        m_slots[(m_head + m_size) & m_mask] = value;
+        ++m_size;
+    }
+
+    void push_front(const T& value) {
+        check_not_full();
+        m_head = (m_head - 1) & m_mask;
+        m_slots[m_head] = value;
+        ++m_size;
+    }
+
+    void pop_front() {
+        m_head = (m_head + 1) & m_mask;
+        --m_size;
+    }
+
+    void pop_back() { --m_size; }
+
+    void clear() {
+        m_head = 0;
+        m_size = 0;
+    }
+
+    T& operator[](size_t index) { return m_slots[(m_head + index) & m_mask]; }
+    const T& operator[](size_t index) const { return m_slots[(m_head + index) & m_mask]; }
+    T& front() { return (*this)[0]; }
+    const T& front() const { return (*this)[0]; }
+    T& back() { return (*this)[m_size - 1]; }
+    const T& back() const { return (*this)[m_size - 1]; }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, m_size); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_size); }
+
+    size_t size() const { return m_size; }
+    size_t capacity() const { return m_slots.size(); }
+    bool empty() const { return m_size == 0; }
+    bool full() const { return m_size == m_slots.size(); }
+
+private:
+    void check_not_full() const {
+        if (full()) {
+            throw std::length_error("CRingBuffer の容量を超えて追加しようとしました");
+        }
+    }
+
+    std::vector<T> m_slots;  // 要素の格納領域（容量は 2 のべき乗）
+    size_t m_mask = 0;       // 容量 - 1
+    size_t m_head = 0;       // 先頭要素の位置
+    size_t m_size = 0;       // 要素数
+};
+
+// ===== アンロールドリスト =====
+/**
+ * @brief 固定長の配列ノードを双方向に連結したアンロールドリスト
+ *
+ * 1 ノードに最大 `ChunkSize` 要素を連続して格納するため、走査は list よりキャッシュ効率が高く、
+ * ポインタ追跡はノード単位（ChunkSize 要素に 1 回）で済みます。各ノードは `[m_first, m_last)` の
+ * 区間を使うので、両端の追加・削除は O(1) です。中間挿入はノード内のシフト（満杯なら半分に分割）、
+ * splice は挿入位置のノードを 1 回分割するだけなので、いずれも要素数によらず O(ChunkSize) です。
+ * イテレータは双方向で、挿入・splice は挿入位置のノードを指すイテレータを無効にします。
+ */
+template<typename T, size_t ChunkSize = BenchmarkConfig::UnrolledChunkSize>
+class CUnrolledList final {
+    static_assert(ChunkSize >= 2, "ChunkSize は 2 以上にしてください");
+
+    struct Node {
+        Node* prev = nullptr;           // 前のノード
+        Node* next = nullptr;           // 次のノード
+        size_t first = 0;               // 使用中区間の先頭
+        size_t last = 0;                // 使用中区間の末尾（含まない）
+        std::array<T, ChunkSize> values; // 要素の格納領域
+    };
+
+    /**
+     * @brief ノードとノード内位置を保持する双方向イテレータ
+     */
+    template<bool IsConst>
+    class Iterator final {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using Owner = std::conditional_t<IsConst, const CUnrolledList, CUnrolledList>;
+
+        Iterator() = default;
+        Iterator(Owner* owner, Node* node, size_t index) : m_owner(owner), m_node(node), m_index(index) {}
+        // 非 const から const への変換
+        template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        Iterator(const Iterator<OtherConst>& other) : m_owner(other.m_owner), m_node(other.m_node), m_index(other.m_index) {}
+
+        reference operator*() const { return m_node->values[m_index]; }
+        pointer operator->() const { return &m_node->values[m_index]; }
+
+        Iterator& operator++() {
+            if (++m_index == m_node->last) {
+                m_node = m_node->next;
+                m_index = m_node != nullptr ? m_node->first : 0;
+            }
+            return *this;
+        }
+        Iterator operator++(int) { Iterator old = *this; ++*this; return old; }
+        Iterator& operator--() {
+            if (m_node == nullptr) {
+                m_node = m_owner->m_tail;
+                m_index = m_node->last;
+            } else if (m_index == m_node->first) {
+                m_node = m_node->prev;
+                m_index = m_node->last;
+            }
+            --m_index;
+            return *this;
+        }
+        Iterator operator--(int) { Iterator old = *this; --*this; return old; }
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.m_node == b.m_node && a.m_index == b.m_index; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return !(a == b); }
+
+    private:
+        friend class Iterator<!IsConst>;
+        friend class CUnrolledList;
+        Owner* m_owner = nullptr;  // 対象のリスト（end からの後退に使用）
+        Node* m_node = nullptr;    // 現在のノード（end なら nullptr）
+        size_t m_index = 0;        // ノード内の位置
+    };
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    CUnrolledList() = default;
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    CUnrolledList(InputIt first, InputIt last) {
+        append(first, last);
+    }
+    ~CUnrolledList() { clear(); }
+
+    CUnrolledList(const CUnrolledList&) = delete;
+    CUnrolledList& operator=(const CUnrolledList&) = delete;
+    CUnrolledList(CUnrolledList&& other) noexcept { swap(other); }
+    CUnrolledList& operator=(CUnrolledList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    void push_back(const T& value) {
+        if (m_tail == nullptr || m_tail->last == ChunkSize) {
+            link_before(nullptr, new Node());
+        }
+        m_tail->values[m_tail->last++] = value;
+        ++m_size;
+    }
+
+    void push_front(const T& value) {
+        if (m_head == nullptr || m_head->first == 0) {
+            Node* node = new Node();
+            node->first = node->last = ChunkSize;  // 先頭側へ伸ばせるよう末尾から詰める
+            link_before(m_head, node);
+        }
+        m_head->values[--m_head->first] = value;
+        ++m_size;
+    }
+
+    void pop_front() {
+        --m_size;
+        if (++m_head->first == m_head->last) {
+            destroy(m_head);
+        }
+    }
+
+    void pop_back() {
+        --m_size;
+        if (--m_tail->last == m_tail->first) {
+            destroy(m_tail);
+        }
+    }
+
+    /**
+     * @brief pos の直前に value を挿入し、挿入した要素を指すイテレータを返す
+     *
+     * ノードに空きがあればノード内でシフトし、満杯なら後半を新しいノードへ移してから挿入します。
+     */
+    iterator insert(const_iterator pos, const T& value) {
+        Node* node = pos.m_node;
+        size_t index = pos.m_index;
+        if (node == nullptr) {
+            push_back(value);
+            return iterator(this, m_tail, m_tail->last - 1);
+        }
+        if (node->first > 0 && (node->last == ChunkSize || index - node->first < node->last - index)) {
+            // 前半を 1 つ前へずらす
+            std::move(node->values.begin() + static_cast<std::ptrdiff_t>(node->first),
+                      node->values.begin() + static_cast<std::ptrdiff_t>(index),
+                      node->values.begin() + static_cast<std::ptrdiff_t>(node->first - 1));
+            --node->first;
+            --index;
+        } else {
+            if (node->last == ChunkSize) {
+                Node* upper = split(node, node->first + (node->last - node->first) / 2);
+                if (index >= node->last) {
+                    index -= node->last;
+                    node = upper;
+                }
+            }
+            // 後半を 1 つ後ろへずらす
+            std::move_backward(node->values.begin() + static_cast<std::ptrdiff_t>(index),
+                               node->values.begin() + static_cast<std::ptrdiff_t>(node->last),
+                               node->values.begin() + static_cast<std::ptrdiff_t>(node->last + 1));
+            ++node->last;
+        }
+        node->values[index] = value;
+        ++m_size;
+        return iterator(this, node, index);
+    }
+
+    /**
+     * @brief pos の直前に [first, last) を挿入し、挿入した先頭要素を指すイテレータを返す
+     *
+     * 末尾への挿入は末尾ノードの空きから順にノード単位で詰めます。途中への挿入は同じ方法で
+     * 別のリストを作ってから splice します。
+     */
+    template<typename InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        if (first == last) {
+            return iterator(this, pos.m_node, pos.m_index);
+        }
+        if (pos.m_node == nullptr) {
+            Node* tail = m_tail;
+            const bool tail_has_room = tail != nullptr && tail->last < ChunkSize;
+            const size_t index = tail_has_room ? tail->last : 0;
+            append(first, last);
+            Node* node = tail_has_room ? tail : (tail != nullptr ? tail->next : m_head);
+            return iterator(this, node, tail_has_room ? index : node->first);
+        }
+        CUnrolledList inserted(first, last);
+        Node* node = inserted.m_head;
+        splice(pos, inserted);
+        return iterator(this, node, node->first);
+    }
+
+    /**
+     * @brief 内容を [first, last) で置き換える
+     */
+    template<typename InputIt>
+    void assign(InputIt first, InputIt last) {
+        clear();
+        append(first, last);
+    }
+
+    /**
+     * @brief other の全要素を pos の直前へ移す（要素のコピーなし）
+     *
+     * pos がノードの途中なら、そのノードを pos で 2 つに分割してから other のノード列を繋ぎます。
+     */
+    void splice(const_iterator pos, CUnrolledList& other) {
+        if (other.empty() || &other == this) {
+            return;
+        }
+        Node* before = pos.m_node;
+        if (before != nullptr && pos.m_index != before->first) {
+            before = split(before, pos.m_index);
+        }
+        Node* prev = before != nullptr ? before->prev : m_tail;
+        other.m_head->prev = prev;
+        other.m_tail->next = before;
+        (prev != nullptr ? prev->next : m_head) = other.m_head;
+        (before != nullptr ? before->prev : m_tail) = other.m_tail;
+        m_size += other.m_size;
+        other.m_head = other.m_tail = nullptr;
+        other.m_size = 0;
+    }
+
+    /**
+     * @brief 昇順に並べ替える（安定）
+     *
+     * 各ノードを std::sort で整列した列とみなし、隣り合う列を std::merge で併合していきます。
+     */
+    void sort() {
+        std::vector<CUnrolledList> runs;
+        while (m_head != nullptr) {
+            Node* node = m_head;
+            m_head = node->next;
+            node->prev = node->next = nullptr;
+            std::stable_sort(node->values.begin() + static_cast<std::ptrdiff_t>(node->first),
+                             node->values.begin() + static_cast<std::ptrdiff_t>(node->last));
+            CUnrolledList run;
+            run.m_head = run.m_tail = node;
+            run.m_size = node->last - node->first;
+            runs.push_back(std::move(run));
+        }
+        m_tail = nullptr;
+        m_size = 0;
+        while (runs.size() > 1) {
+            std::vector<CUnrolledList> merged;
+            for (size_t i = 0; i + 1 < runs.size(); i += 2) {
+                CUnrolledList out;
+                std::merge(runs[i].begin(), runs[i].end(), runs[i + 1].begin(), runs[i + 1].end(), std::back_inserter(out));
+                merged.push_back(std::move(out));
+            }
+            if (runs.size() % 2 == 1) {
+                merged.push_back(std::move(runs.back()));
+            }
+            runs = std::move(merged);
+        }
+        if (!runs.empty()) {
+            swap(runs.front());
+        }
+    }
+
+    void clear() {
+        while (m_head != nullptr) {
+            Node* next = m_head->next;
+            delete m_head;
+            m_head = next;
+        }
+        m_tail = nullptr;
+        m_size = 0;
+    }
+
+    void swap(CUnrolledList& other) noexcept {
+        std::swap(m_head, other.m_head);
+        std::swap(m_tail, other.m_tail);
+        std::swap(m_size, other.m_size);
+    }
+
+    T& front() { return m_head->values[m_head->first]; }
+    const T& front() const { return m_head->values[m_head->first]; }
+    T& back() { return m_tail->values[m_tail->last - 1]; }
+    const T& back() const { return m_tail->values[m_tail->last - 1]; }
+
+    iterator begin() { return iterator(this, m_head, m_head != nullptr ? m_head->first : 0); }
+    iterator end() { return iterator(this, nullptr, 0); }
+    const_iterator begin() const { return const_iterator(this, m_head, m_head != nullptr ? m_head->first : 0); }
+    const_iterator end() const { return const_iterator(this, nullptr, 0); }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+private:
+    /**
+     * @brief [first, last) を末尾へ追加する（末尾ノードの空きを埋めてから、新しいノードを満杯まで詰める）
+     */
+    template<typename InputIt>
+    void append(InputIt first, InputIt last) {
+        while (first != last) {
+            if (m_tail == nullptr || m_tail->last == ChunkSize) {
+                link_before(nullptr, new Node());
+            }
+            const size_t before = m_tail->last;
+            while (first != last && m_tail->last < ChunkSize) {
+                m_tail->values[m_tail->last++] = *first;
+                ++first;
+            }
+            m_size += m_tail->last - before;
+        }
+    }
+
+    /**
+     * @brief node を next の直前（nullptr なら末尾）に繋ぐ
+     */
+    void link_before(Node* next, Node* node) {
+        Node* prev = next != nullptr ? next->prev : m_tail;
+        node->prev = prev;
+        node->next = next;
+        (prev != nullptr ? prev->next : m_head) = node;
+        (next != nullptr ? next->prev : m_tail) = node;
+    }
+
+    /**
+     * @brief node の [index, last) を新しいノードへ移して node の直後に繋ぎ、新しいノードを返す
+     */
+    Node* split(Node* node, size_t index) {
+        Node* upper = new Node();
+        upper->last = static_cast<size_t>(std::move(node->values.begin() + static_cast<std::ptrdiff_t>(index),
+                                                    node->values.begin() + static_cast<std::ptrdiff_t>(node->last),
+                                                    upper->values.begin()) - upper->values.begin());
+        node->last = index;
+        link_before(node->next, upper);
+        return upper;
+    }
+
+    /**
+     * @brief 空になったノードを外して解放する
+     */
+    void destroy(Node* node) {
+        (node->prev != nullptr ? node->prev->next : m_head) = node->next;
+        (node->next != nullptr ? node->next->prev : m_tail) = node->prev;
+        delete node;
+    }
+
+    Node* m_head = nullptr;  // 先頭ノード
+    Node* m_tail = nullptr;  // 末尾ノード
+    size_t m_size = 0;       // 要素数
+};
+
+// ===== スレッド間受け渡し =====
+/**
+ * @brief 単一生産者・単一消費者のロックフリー有界キュー
+ *
+ * 容量は 2 のべき乗に切り上げ、インデックスはマスクで折り返します。生産者は `m_tail`、
+ * 消費者は `m_head` だけを書き込むため、acquire / release の原子操作だけで受け渡しできます。
+ * 両インデックスは別キャッシュラインに置き、偽共有を避けます。
+ */
+template<typename T>
+class CSpscRing final {
+public:
+    explicit CSpscRing(size_t capacity) {
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        m_slots.resize(rounded);
+        m_mask = rounded - 1;
+    }
+
+    /**
+     * @brief 末尾へ追加する（満杯なら false）
+     */
+    bool try_push(const T& value) {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) == m_slots.size()) {
+            return false;
+        }
+        m_slots[tail & m_mask] = value;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 先頭から取り出す（空なら false）
+     */
+    bool try_pop(T& value) {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = m_slots[head & m_mask];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 追加できるまで待つ（相手スレッドに CPU を譲りながらスピン）
+     */
+    void push(const T& value) {
+        while (!try_push(value)) {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief 取り出せるまで待つ
+     */
+    T pop() {
+        T value{};
+        while (!try_pop(value)) {
+            std::this_thread::yield();
+        }
+        return value;
+    }
+
+private:
+    std::vector<T> m_slots;  // リングバッファ本体
+    size_t m_mask = 0;       // 容量 - 1
+    alignas(64) std::atomic<size_t> m_head{0};  // 次に取り出す位置（消費者のみ更新）
+    alignas(64) std::atomic<size_t> m_tail{0};  // 次に追加する位置（生産者のみ更新）
+};
+
+/**
+ * @brief std::deque を std::mutex と条件変数で保護した無制限キュー（従来方式の基準）
+ */
+template<typename T>
+class CLockedDeque final {
+public:
+    explicit CLockedDeque(size_t /*capacity*/ = 0) {}
+
+    void push(const T& value) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_items.push_back(value);
+        }
+        m_not_empty.notify_one();
+    }
+
+    T pop() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_not_empty.wait(lock, [this]() { return !m_items.empty(); });
+        T value = m_items.front();
+        m_items.pop_front();
+        return value;
+    }
+
+private:
+    std::mutex m_mutex;                   // m_items を保護
+    std::condition_variable m_not_empty;  // 要素の追加を通知
+    std::deque<T> m_items;                // キュー本体
+};
+
+/**
+ * @brief 有界の複数生産者・複数消費者ロックフリーキュー（Dmitry Vyukov 方式）
+ *
+ * 各セルが持つシーケンス番号で「書き込み可能」「読み出し可能」を判別し、生産者・消費者はそれぞれ
+ * 位置カウンタを CAS で進めるだけで受け渡します。容量は 2 のべき乗に切り上げます。
+ */
+template<typename T>
+class CMpmcQueue final {
+public:
+    explicit CMpmcQueue(size_t capacity) {
+        size_t rounded = 2;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        m_cells = std::make_unique<Cell[]>(rounded);
+        m_mask = rounded - 1;
+        for (size_t i = 0; i < rounded; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief 末尾へ追加する（満杯なら false）
+     */
+    bool try_push(const T& value) {
+        size_t position = m_enqueue_position.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true) {
+            cell = &m_cells[position & m_mask];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (diff == 0) {
+                if (m_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = m_enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = value;
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 先頭から取り出す（空なら false）
+     */
+    bool try_pop(T& value) {
+        size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true) {
+            cell = &m_cells[position & m_mask];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+            if (diff == 0) {
+                if (m_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = m_dequeue_position.load(std::memory_order_relaxed);
+            }
+        }
+        value = cell->data;
+        cell->sequence.store(position + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    void push(const T& value) {
+        while (!try_push(value)) {
+            std::this_thread::yield();
+        }
+    }
+
+    T pop() {
+        T value{};
+        while (!try_pop(value)) {
+            std::this_thread::yield();
+        }
+        return value;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};  // セルの状態を表す番号
+        T data{};                         // 格納値
+    };
+
+    std::unique_ptr<Cell[]> m_cells;  // セル配列
+    size_t m_mask = 0;                // 容量 - 1
+    alignas(64) std::atomic<size_t> m_enqueue_position{0};  // 次に書き込む位置
+    alignas(64) std::atomic<size_t> m_dequeue_position{0};  // 次に読み出す位置
+};
+
+/**
+ * @brief スレッド間で受け渡すメッセージ
+ */
+template<typename T>
+struct HandoffMessage {
+    T value{};
+    std::int64_t stamp_ns = 0;  // 送信時刻（0 は計測対象外、-1 は終端）
+};
+
+/**
+ * @brief 生産者 producers 個・消費者 consumers 個で元データを受け渡し、スループットと遅延を表示する
+ *
+ * 元データを生産者数で等分して各生産者が送り、`LatencySampleInterval` 件ごとに送信時刻を添えます。
+ * 消費者は受信時刻との差を受け渡し遅延として記録します。生産者の終了後、消費者数ぶんの終端
+ * メッセージを送って消費者を終了させます。受信値の合計が元データの合計と一致するかも確認します。
+ */
+template<template<typename> class Queue, typename Source>
+void measure_handoff(const std::string& name, const Source& src_array, size_t producers, size_t consumers) {
+    using T = typename Source::value_type;
+    using Message = HandoffMessage<T>;
+    auto now_ns = []() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    };
+
+    Queue<Message> queue(BenchmarkConfig::HandoffQueueCapacity);
+    std::vector<std::int64_t> sums(consumers, 0);
+    std::vector<std::vector<std::int64_t>> latencies(consumers);
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> consumer_threads;
+    for (size_t c = 0; c < consumers; ++c) {
+        consumer_threads.emplace_back([&, c]() {
+            std::int64_t sum = 0;
+            for (Message message = queue.pop(); message.stamp_ns >= 0; message = queue.pop()) {
+                sum += message.value;
+                if (message.stamp_ns > 0) {
+                    latencies[c].push_back(now_ns() - message.stamp_ns);
+                }
+            }
+            sums[c] = sum;
+        });
+    }
+    std::vector<std::thread> producer_threads;
+    for (size_t p = 0; p < producers; ++p) {
+        producer_threads.emplace_back([&, p]() {
+            const size_t first = src_array.size() * p / producers;
+            const size_t last = src_array.size() * (p + 1) / producers;
+            for (size_t i = first; i < last; ++i) {
+                const bool sampled = i % BenchmarkConfig::LatencySampleInterval == 0;
+                queue.push(Message{src_array.data()[i], sampled ? now_ns() : 0});
+            }
+        });
+    }
+    for (auto& producer : producer_threads) {
+        producer.join();
+    }
+    for (size_t c = 0; c < consumers; ++c) {
+        queue.push(Message{T{}, -1});
+    }
+    for (auto& consumer : consumer_threads) {
+        consumer.join();
+    }
+    const double elapsed_ms = elapsed_milliseconds(start);
+
+    std::vector<std::int64_t> samples;
+    for (const auto& per_consumer : latencies) {
+        samples.insert(samples.end(), per_consumer.begin(), per_consumer.end());
+    }
+    const std::int64_t received_sum = std::accumulate(sums.begin(), sums.end(), std::int64_t{0});
+    const std::int64_t expected_sum = std::accumulate(src_array.begin(), src_array.end(), std::int64_t{0});
+    const double items_per_sec = static_cast<double>(src_array.size()) / (elapsed_ms / 1000.0);
+    std::cout << std::fixed << std::setprecision(2) << name << " (生産者 " << producers << " / 消費者 " << consumers << "): "
+              << items_per_sec / 1e6 << " M件/s, 遅延 p50 " << percentile(samples, 0.50) << " ns / p99 " << percentile(samples, 0.99)
+              << " ns" << (received_sum == expected_sum ? "" : " [合計不一致]") << std::endl;
+}
+
+/**
+ * @brief スレッド間受け渡しのベンチマーク（mutex + deque / SPSC リング / MPMC キュー）
+ *
+ * SPSC リングは生産者・消費者が各 1 個の場合のみ計測します。スレッド数は 1, 2, 4, ... と
+ * `HandoffMaxThreads` まで倍々に増やします（生産者数 = 消費者数）。
+ */
+template<typename Source>
+void run_handoff_benchmark(const Source& src_array) {
+    std::cout << "\n● スレッド間受け渡し（キュー容量 " << BenchmarkConfig::HandoffQueueCapacity << ", 論理コア数 "
+              << std::thread::hardware_concurrency() << "）\n";
+    for (size_t threads = 1; threads <= BenchmarkConfig::HandoffMaxThreads; threads *= 2) {
+        measure_handoff<CLockedDeque>("mutex+deque", src_array, threads, threads);
+        if (threads == 1) {
+            measure_handoff<CSpscRing>("SPSCリング", src_array, threads, threads);
+        }
+        measure_handoff<CMpmcQueue>("MPMCキュー", src_array, threads, threads);
+    }
+}
+
+// ===== 同時読み取りスケーリング =====
+/**
+ * @brief 1 つの共有コンテナを N スレッドで同時に読み取り、スケーリングを表示する
+ *
+ * 各スレッドは同じコンテナに対して `read_container`・`average`・`variance` を実行します。
+ * 全スレッドを開始フラグで同時に走らせ、全体の経過時間から総スループット（要素/秒）を、
+ * 各スレッドの所要時間の平均と 1 スレッド時との比から 1 スレッドあたりの低速化率を求めます。
+ * スレッド数を増やしても総スループットが伸びなくなる点がメモリ帯域の飽和点の目安です。
+ */
+template<typename Container>
+void measure_read_scaling(const Container& container, const std::string& name) {
+    const double elements_per_thread = static_cast<double>(container.size()) * (BenchmarkConfig::ReadingRepeat + 2);
+    double single_thread_ms = 0.0;
+    for (size_t threads = 1; threads <= BenchmarkConfig::ReadScalingMaxThreads; threads *= 2) {
+        std::atomic<bool> go{false};
+        std::atomic<size_t> ready{0};
+        std::vector<double> thread_ms(threads, 0.0);
+        std::vector<double> results(threads, 0.0);
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t]() {
+                ready.fetch_add(1);
+                while (!go.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                const auto start = std::chrono::steady_clock::now();
+                read_container(container);
+                results[t] = average(container) + variance(container);
+                thread_ms[t] = elapsed_milliseconds(start);
+            });
+        }
+        while (ready.load() < threads) {
+            std::this_thread::yield();
+        }
+        const auto wall_start = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        const double wall_ms = elapsed_milliseconds(wall_start);
+        const double mean_thread_ms = std::accumulate(thread_ms.begin(), thread_ms.end(), 0.0) / static_cast<double>(threads);
+        if (threads == 1) {
+            single_thread_ms = mean_thread_ms;
+        }
+        const double throughput = elements_per_thread * static_cast<double>(threads) / (wall_ms / 1000.0);
+        std::cout << std::fixed << std::setprecision(2) << name << " x" << threads << "スレッド: 総スループット "
+                  << throughput / 1e9 << " G要素/s, 1スレッドあたり " << mean_thread_ms << " ms (低速化 x"
+                  << mean_thread_ms / single_thread_ms << ")" << std::endl;
+    }
+}
+
+// ===== 部分和のレイアウトと偽共有 =====
+#ifdef __cpp_lib_hardware_interference_size
+constexpr size_t DestructiveInterferenceSize = std::hardware_destructive_interference_size;
+#else
+constexpr size_t DestructiveInterferenceSize = 64;  // 未対応の標準ライブラリでは一般的なキャッシュライン長
+#endif
+
+/**
+ * @brief 偽共有を避けるため、1 要素ごとにキャッシュライン長へ揃えた部分和スロット
+ */
+struct alignas(DestructiveInterferenceSize) PaddedSlot {
+    std::int64_t value = 0;
+};
+
+/**
+ * @brief スレッドごとの部分和をどこに置くかで、並列リダクションのスループットを比較する
+ *
+ * 各スレッドは元データ全体を `AccumulatorRepeat` 回走査し、要素ごとに自分の部分和を更新します。
+ * 部分和は volatile 参照経由で毎回メモリへ書き込むため、置き場所の違いがそのまま現れます。
+ * - vector隣接: std::vector<int64_t> の隣り合うスロット（同じキャッシュラインを共有 = 偽共有）
+ * - vectorパディング: キャッシュライン長に揃えた PaddedSlot の std::vector
+ * - スレッドローカル: スレッドのローカル変数に累積し、最後に 1 回だけ書き込む
+ * - deque隣接: std::deque<int64_t> の隣り合うスロット（同じブロック内なので偽共有）
+ */
+template<typename Source>
+void run_accumulator_layout_benchmark(const Source& src_array) {
+    std::cout << "\n● 部分和レイアウトと偽共有（キャッシュライン " << DestructiveInterferenceSize << " バイト, 論理コア数 "
+              << std::thread::hardware_concurrency() << "）\n";
+    const std::int64_t expected = std::accumulate(src_array.begin(), src_array.end(), std::int64_t{0}) *
+                                  static_cast<std::int64_t>(BenchmarkConfig::AccumulatorRepeat);
+
+    // スロットへ要素ごとに書き込みながら累積する（volatile なので毎回メモリへ反映される）
+    auto accumulate_into = [&](volatile std::int64_t& slot) {
+        for (size_t r = 0; r < BenchmarkConfig::AccumulatorRepeat; ++r) {
+            for (const auto value : src_array) {
+                slot = slot + value;
+            }
+        }
+    };
+    // ローカル変数へ累積して結果だけを返す
+    auto accumulate_local = [&]() {
+        std::int64_t local = 0;
+        for (size_t r = 0; r < BenchmarkConfig::AccumulatorRepeat; ++r) {
+            for (const auto value : src_array) {
+                local += value;
+            }
+        }
+        return local;
+    };
+    // threads 個のスレッドで work(t) を実行し、スループットと各スロットの正しさを表示する
+    auto measure = [&](const std::string& name, size_t threads, auto&& work, auto&& read_slot) {
+        std::vector<std::thread> workers;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t]() { work(t); });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        const double wall_ms = elapsed_milliseconds(start);
+        bool correct = true;
+        for (size_t t = 0; t < threads; ++t) {
+            correct = correct && read_slot(t) == expected;
+        }
+        const double updates = static_cast<double>(src_array.size() * BenchmarkConfig::AccumulatorRepeat * threads);
+        std::cout << std::fixed << std::setprecision(2) << name << " x" << threads << "スレッド: " << updates / (wall_ms * 1e3)
+                  << " M更新/s (" << wall_ms << " ms)" << (correct ? "" : " [合計不一致]") << std::endl;
+    };
+
+    for (size_t threads = 1; threads <= BenchmarkConfig::ReadScalingMaxThreads; threads *= 2) {
+        {
+            std::vector<std::int64_t> slots(threads, 0);
+            measure("vector隣接", threads, [&](size_t t) { accumulate_into(slots[t]); }, [&](size_t t) { return slots[t]; });
+        }
+        {
+            std::vector<PaddedSlot> slots(threads);
+            measure("vectorパディング", threads, [&](size_t t) { accumulate_into(slots[t].value); },
+                    [&](size_t t) { return slots[t].value; });
+        }
+        {
+            std::vector<std::int64_t> slots(threads, 0);
+            measure("スレッドローカル", threads, [&](size_t t) { slots[t] = accumulate_local(); }, [&](size_t t) { return slots[t]; });
+        }
+        {
+            std::deque<std::int64_t> slots(threads, 0);
+            measure("deque隣接", threads, [&](size_t t) { accumulate_into(slots[t]); }, [&](size_t t) { return slots[t]; });
+        }
+    }
+}
+
+// ===== ワークスティーリング =====
+/**
+ * @brief Chase-Lev のワークスティーリング両端キュー（容量固定）
+ *
+ * 所有スレッドは末尾（bottom）で push / take し、他のスレッドは先頭（top）から steal します。
+ * 所有者同士の競合がないため、末尾操作は最後の 1 要素を取り合う場合を除き CAS 不要です
+ * （Lê ほか 2013 の C11 メモリモデル版に準拠）。要素はタスク番号です。
+ */
+class CChaseLevDeque final {
+public:
+    explicit CChaseLevDeque(size_t capacity) {
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        m_buffer = std::make_unique<std::atomic<std::int64_t>[]>(rounded);
+        m_mask = static_cast<std::int64_t>(rounded - 1);
+    }
+
+    /**
+     * @brief 末尾へ追加する（所有者のみ。満杯なら false）
+     */
+    bool push(std::int64_t item) {
+        const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = m_top.load(std::memory_order_acquire);
+        if (bottom - top > m_mask) {
+            return false;
+        }
+        m_buffer[bottom & m_mask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief 末尾から取り出す（所有者のみ。空なら false）
+     */
+    bool take(std::int64_t& item) {
+        const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = m_top.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+        item = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // 最後の 1 要素は steal と競合し得るため CAS で確定させる
+            const bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /**
+     * @brief 先頭から盗む（任意のスレッド。空または競合に負けたら false）
+     */
+    bool steal(std::int64_t& item) {
+        std::int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return false;
+        }
+        item = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+        return m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+private:
+    std::unique_ptr<std::atomic<std::int64_t>[]> m_buffer;  // リングバッファ
+    std::int64_t m_mask = 0;                                // 容量 - 1
+    alignas(64) std::atomic<std::int64_t> m_top{0};         // 盗まれる側の位置
+    alignas(64) std::atomic<std::int64_t> m_bottom{0};      // 所有者側の位置
+};
+
+/**
+ * @brief ワーカーごとに Chase-Lev 両端キューを持つワークスティーリング・スレッドプール
+ *
+ * `run` はタスク番号 0..N-1 をワーカー数で連続ブロックに分けて各キューへ積み（静的分割と同じ初期配置）、
+ * 自分のキューが空になったワーカーは他のキューの先頭から盗みます。処理コストが不均一でも、
+ * 早く終わったワーカーが遅いワーカーの残りを引き受けるため、コアが遊びにくくなります。
+ * ワーカースレッドはプールの生存期間中再利用されます。
+ */
+class CWorkStealingPool final {
+public:
+    explicit CWorkStealingPool(size_t worker_count) {
+        worker_count = std::max<size_t>(1, worker_count);
+        for (size_t i = 0; i < worker_count; ++i) {
+            m_deques.push_back(std::make_unique<CChaseLevDeque>(1));
+        }
+        for (size_t i = 0; i < worker_count; ++i) {
+            m_threads.emplace_back([this, i]() { worker_loop(i); });
+        }
+    }
+
+    ~CWorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    CWorkStealingPool(const CWorkStealingPool&) = delete;
+    CWorkStealingPool& operator=(const CWorkStealingPool&) = delete;
+
+    /**
+     * @brief タスク 0..task_count-1 を実行し、すべて終わるまで待つ
+     * @param body タスク番号を受け取る処理（並行に呼ばれる）
+     */
+    void run(size_t task_count, const std::function<void(size_t)>& body) {
+        if (task_count == 0) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // 前回のジョブのワーカーがキューから離れるまで待ってから作り直す
+        m_done.wait(lock, [this]() { return m_busy == 0; });
+        const size_t workers = m_deques.size();
+        for (size_t w = 0; w < workers; ++w) {
+            const size_t first = task_count * w / workers;
+            const size_t last = task_count * (w + 1) / workers;
+            m_deques[w] = std::make_unique<CChaseLevDeque>(last - first);
+            // ワーカーは待機中なので、所有者の代わりにここで積んでよい（ロック解放で公開される）
+            for (size_t task = last; task > first; --task) {
+                m_deques[w]->push(static_cast<std::int64_t>(task - 1));
+            }
+        }
+        m_body = &body;
+        m_remaining.store(task_count, std::memory_order_release);
+        ++m_generation;
+        m_wake.notify_all();
+        m_done.wait(lock, [this]() { return m_busy == 0 && m_remaining.load(std::memory_order_acquire) == 0; });
+        m_body = nullptr;
+    }
+
+    size_t worker_count() const { return m_threads.size(); }
+
+private:
+    /**
+     * @brief 自分のキュー、次に他のワーカーのキューからタスクを探す
+     */
+    bool find_task(size_t self, std::int64_t& task) {
+        if (m_deques[self]->take(task)) {
+            return true;
+        }
+        for (size_t offset = 1; offset < m_deques.size(); ++offset) {
+            if (m_deques[(self + offset) % m_deques.size()]->steal(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void worker_loop(size_t self) {
+        size_t seen_generation = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [&]() { return m_stop || m_generation != seen_generation; });
+                if (m_stop) {
+                    return;
+                }
+                seen_generation = m_generation;
+                ++m_busy;
+            }
+            std::int64_t task = 0;
+            while (m_remaining.load(std::memory_order_acquire) > 0) {
+                if (find_task(self, task)) {
+                    (*m_body)(static_cast<size_t>(task));
+                    m_remaining.fetch_sub(1, std::memory_order_acq_rel);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                --m_busy;
+            }
+            m_done.notify_all();
+        }
+    }
+
+    std::vector<std::unique_ptr<CChaseLevDeque>> m_deques;  // ワーカーごとのタスクキュー
+    std::vector<std::thread> m_threads;                     // ワーカースレッド
+    std::mutex m_mutex;                                     // 以下の状態を保護
+    std::condition_variable m_wake;                         // ジョブ開始・停止の通知
+    std::condition_variable m_done;                         // ワーカーの離脱通知
+    size_t m_generation = 0;                                // ジョブの通し番号
+    size_t m_busy = 0;                                      // ジョブを処理中のワーカー数
+    bool m_stop = false;                                    // 停止要求
+    const std::function<void(size_t)>* m_body = nullptr;    // 実行中のタスク処理
+    std::atomic<size_t> m_remaining{0};                     // 未完了のタスク数
+};
+
+/**
+ * @brief タスク 0..task_count-1 を threads 本の std::thread へ連続ブロックで静的に割り当てて実行する
+ */
+inline void static_fan_out(size_t threads, size_t task_count, const std::function<void(size_t)>& body) {
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            for (size_t task = task_count * t / threads; task < task_count * (t + 1) / threads; ++task) {
+                body(task);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief 並列コピー・読み取り・統計を、静的分割とワークスティーリングで比較する
+ *
+ * どちらも `ParallelGrain` 要素ずつのタスクに分け、同じタスク列を実行します。統計は
+ * タスクごとの Welford 状態をタスク順に結合するので、スケジューラによらず同じ結果になります。
+ * 不均一タスクでは長さが Zipf 分布に従う `UnevenListCount` 本の list を 1 本 1 タスクで集計し、
+ * 長い list が先頭に偏るため静的分割ではスレッド間の負荷が偏ります。
+ */
+template<typename Source>
+void run_work_stealing_benchmark(const Source& src_array) {
+    using T = typename Source::value_type;
+    const size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "\n● 並列処理: 静的分割 vs ワークスティーリング（" << threads << " スレッド, タスク " << BenchmarkConfig::ParallelGrain
+              << " 要素）\n";
+    CWorkStealingPool pool(threads);
+    const size_t n = src_array.size();
+    const size_t chunks = (n + BenchmarkConfig::ParallelGrain - 1) / BenchmarkConfig::ParallelGrain;
+    auto chunk_begin = [&](size_t chunk) { return std::min(n, chunk * BenchmarkConfig::ParallelGrain); };
+
+    // list のタスク境界（1 回の走査で各チャンクの先頭イテレータを求めておく）
+    const std::list<T> list(src_array.begin(), src_array.end());
+    std::vector<typename std::list<T>::const_iterator> list_bounds;
+    {
+        auto it = list.begin();
+        for (size_t i = 0; i < n; ++i, ++it) {
+            if (i % BenchmarkConfig::ParallelGrain == 0) {
+                list_bounds.push_back(it);
+            }
+        }
+        list_bounds.push_back(list.end());
+    }
+
+    // 不均一タスク: i 本目の長さは 1 / (i + 1) に比例
+    std::vector<std::list<T>> uneven_lists(BenchmarkConfig::UnevenListCount);
+    {
+        double harmonic = 0.0;
+        for (size_t i = 0; i < uneven_lists.size(); ++i) {
+            harmonic += 1.0 / static_cast<double>(i + 1);
+        }
+        size_t next = 0;
+        for (size_t i = 0; i < uneven_lists.size() && next < n; ++i) {
+            const auto length = static_cast<size_t>(static_cast<double>(n) / (harmonic * static_cast<double>(i + 1)));
+            const size_t last = i + 1 == uneven_lists.size() ? n : std::min(n, next + length);
+            uneven_lists[i].assign(src_array.begin() + next, src_array.begin() + last);
+            next = last;
+        }
+    }
+
+    using Scheduler = std::function<void(size_t, const std::function<void(size_t)>&)>;
+    const std::vector<std::pair<std::string, Scheduler>> schedulers = {
+        {"静的分割", [&](size_t count, const std::function<void(size_t)>& body) { static_fan_out(threads, count, body); }},
+        {"ワークスティーリング", [&](size_t count, const std::function<void(size_t)>& body) { pool.run(count, body); }},
+    };
+    for (const auto& [name, schedule] : schedulers) {
+        {
+            std::vector<T> destination(n);
+            CScopeProfiler profiler(name + "_vector_copy");
+            schedule(chunks, [&](size_t chunk) {
+                std::copy(src_array.begin() + chunk_begin(chunk), src_array.begin() + chunk_begin(chunk + 1),
+                          destination.begin() + static_cast<std::ptrdiff_t>(chunk_begin(chunk)));
+            });
+        }
+        {
+            CScopeProfiler profiler(name + "_read");
+            schedule(chunks, [&](size_t chunk) {
+                volatile T sink{};
+                for (size_t r = 0; r < BenchmarkConfig::ReadingRepeat; ++r) {
+                    for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+                        sink = src_array.data()[i];
+                    }
+                }
+                (void)sink;
+            });
+        }
+        // タスクごとの Welford 状態を順に結合して分散を求める
+        auto fold_partials = [](const std::vector<WelfordState>& partials) {
+            WelfordState total;
+            for (const auto& partial : partials) {
+                total.merge(partial);
+            }
+            return total;
+        };
+        {
+            std::vector<WelfordState> partials(chunks);
+            CScopeProfiler profiler(name + "_vector_統計");
+            schedule(chunks, [&](size_t chunk) {
+                partials[chunk] = welford_fold(src_array.begin() + chunk_begin(chunk), src_array.begin() + chunk_begin(chunk + 1));
+            });
+            const WelfordState total = fold_partials(partials);
+            std::cout << std::fixed << std::setprecision(3) << name << " vectorの平均値/分散: " << total.mean << " / "
+                      << total.variance() << std::endl;
+        }
+        {
+            std::vector<WelfordState> partials(list_bounds.size() - 1);
+            CScopeProfiler profiler(name + "_list_統計");
+            schedule(partials.size(), [&](size_t chunk) { partials[chunk] = welford_fold(list_bounds[chunk], list_bounds[chunk + 1]); });
+            const WelfordState total = fold_partials(partials);
+            std::cout << std::fixed << std::setprecision(3) << name << " listの平均値/分散: " << total.mean << " / "
+                      << total.variance() << std::endl;
+        }
+        {
+            std::vector<WelfordState> partials(uneven_lists.size());
+            CScopeProfiler profiler(name + "_不均一list_統計");
+            schedule(partials.size(), [&](size_t index) {
+                partials[index] = welford_fold(uneven_lists[index].begin(), uneven_lists[index].end());
+            });
+            const WelfordState total = fold_partials(partials);
+            std::cout << std::fixed << std::setprecision(3) << name << " 不均一listの平均値/分散: " << total.mean << " / "
+                      << total.variance() << std::endl;
+        }
+    }
+}
+
+// ===== ソートワークロード =====
+/**
+ * @brief 整数型向けの LSD 基数ソート（8bit ずつ、安定）
+ *
+ * 符号付き型は最上位ビットを反転して符号なしの順序に揃えます。全要素で同じ桁はスキップするため、
+ * 値域の狭いデータでは実質的なパス数が減ります。
+ */
+template<typename T>
+void radix_sort(std::vector<T>& values) {
+    static_assert(std::is_integral_v<T>, "radix_sort は整数型のみ対応");
+    using Unsigned = std::make_unsigned_t<T>;
+    constexpr Unsigned sign_flip = std::is_signed_v<T> ? Unsigned(Unsigned{1} << (sizeof(T) * 8 - 1)) : Unsigned{0};
+    auto key = [](T value) { return static_cast<Unsigned>(static_cast<Unsigned>(value) ^ sign_flip); };
+
+    std::vector<T> buffer(values.size());
+    for (size_t shift = 0; shift < sizeof(T) * 8; shift += 8) {
+        std::array<size_t, 256> counts{};
+        for (const T value : values) {
+            ++counts[(key(value) >> shift) & 0xFFu];
+        }
+        // 全要素が同じ桁ならこのパスは並びを変えない
+        if (std::find(counts.begin(), counts.end(), values.size()) != counts.end()) {
+            continue;
+        }
+        size_t offset = 0;
+        for (auto& count : counts) {
+            offset += std::exchange(count, offset);
+        }
+        for (const T value : values) {
+            buffer[counts[(key(value) >> shift) & 0xFFu]++] = value;
+        }
+        values.swap(buffer);
+    }
+}
+
+/**
+ * @brief std::thread で分割ソートし、ペアごとにマージする並列ソート
+ *
+ * 各スレッドが担当範囲を std::sort し、隣接範囲を std::inplace_merge で段階的に結合します
+ * （各段のマージも並列）。libstdc++ の並列アルゴリズムは TBB 依存のため、標準スレッドのみで実装しています。
+ */
+template<typename T>
+void parallel_sort(std::vector<T>& values, size_t thread_count) {
+    thread_count = std::max<size_t>(1, std::min(thread_count, values.size() / 1024 + 1));
+    std::vector<size_t> bounds(thread_count + 1);
+    for (size_t i = 0; i <= thread_count; ++i) {
+        bounds[i] = values.size() * i / thread_count;
+    }
+    auto at = [&](size_t index) { return values.begin() + static_cast<std::ptrdiff_t>(index); };
+    {
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < thread_count; ++i) {
+            workers.emplace_back([&, i]() { std::sort(at(bounds[i]), at(bounds[i + 1])); });
+        }
+        std::sort(at(bounds[0]), at(bounds[1]));
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+    for (size_t width = 1; width < thread_count; width *= 2) {
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i + width < thread_count; i += 2 * width) {
+            const size_t first = bounds[i];
+            const size_t middle = bounds[i + width];
+            const size_t last = bounds[std::min(i + 2 * width, thread_count)];
+            workers.emplace_back([&, first, middle, last]() { std::inplace_merge(at(first), at(middle), at(last)); });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+}
+
+/**
+ * @brief 入力パターンごとに各コンテナのソートを計測する
+ *
+ * パターン: 一様乱数（元データそのまま）・整列済み・逆順・少数の値（4 種類）。
+ * 各計測は元データから作り直したコンテナに対して行い、コピーは計測に含めません。
+ */
+template<typename Source>
+void run_sort_benchmark(const Source& src_array) {
+    using T = typename Source::value_type;
+    std::cout << "\n● ソート性能\n";
+
+    std::vector<std::pair<std::string, std::vector<T>>> patterns;
+    patterns.emplace_back("一様乱数", std::vector<T>(src_array.begin(), src_array.end()));
+    std::vector<T> sorted_values(src_array.begin(), src_array.end());
+    std::sort(sorted_values.begin(), sorted_values.end());
+    patterns.emplace_back("逆順", std::vector<T>(sorted_values.rbegin(), sorted_values.rend()));
+    patterns.emplace_back("整列済み", std::move(sorted_values));
+    std::vector<T> few_unique(src_array.begin(), src_array.end());
+    for (auto& value : few_unique) {
+        value = static_cast<T>(static_cast<std::int64_t>(value) & 3);  // 値の範囲によらず 0〜3 の 4 種類
+    }
+    patterns.emplace_back("少数の値", std::move(few_unique));
+
+    const size_t thread_count = std::max(1u, std::thread::hardware_concurrency());
+    // 並べ替え結果を検証し、誤りがあれば報告する
+    auto verify = [](const auto& container, const std::string& label) {
+        if (!std::is_sorted(container.begin(), container.end())) {
+            std::cerr << "警告: " << label << " の結果が整列されていません\n";
+        }
+    };
+    for (const auto& [pattern, input] : patterns) {
+        std::cout << "[" << pattern << "]\n";
+        {
+            std::vector<T> vector(input.begin(), input.end());
+            {
+                CScopeProfiler profiler(pattern + "_vector_sort");
+                std::sort(vector.begin(), vector.end());
+            }
+            verify(vector, pattern + "_vector_sort");
+        }
+        {
+            std::vector<T> vector(input.begin(), input.end());
+            {
+                CScopeProfiler profiler(pattern + "_vector_stable_sort");
+                std::stable_sort(vector.begin(), vector.end());
+            }
+            verify(vector, pattern + "_vector_stable_sort");
+        }
+        {
+            std::deque<T> deque(input.begin(), input.end());
+            {
+                CScopeProfiler profiler(pattern + "_deque_sort");
+                std::sort(deque.begin(), deque.end());
+            }
+            verify(deque, pattern + "_deque_sort");
+        }
+        {
+            std::deque<T> deque(input.begin(), input.end());
+            {
+                CScopeProfiler profiler(pattern + "_deque_stable_sort");
+                std::stable_sort(deque.begin(), deque.end());
+            }
+            verify(deque, pattern + "_deque_stable_sort");
+        }
+        {
+            CRingBuffer<T> ring(input.size());
+            std::copy(input.begin(), input.end(), std::back_inserter(ring));
+            {
+                CScopeProfiler profiler(pattern + "_ring_sort");
+                std::sort(ring.begin(), ring.end());
+            }
+            verify(ring, pattern + "_ring_sort");
+        }
+        {
+            std::list<T> list(input.begin(), input.end());
+            {
+                CScopeProfiler profiler(pattern + "_list_sort");
+                list.sort();
+            }
+            verify(list, pattern + "_list_sort");
+        }
+        {
+            CUnrolledList<T> unrolled;
+            std::copy(input.begin(), input.end(), std::back_inserter(unrolled));
+            {
+                CScopeProfiler profiler(pattern + "_unrolled_sort");
+                unrolled.sort();
+            }
+            verify(unrolled, pattern + "_unrolled_sort");
+        }
+        if constexpr (std::is_integral_v<T>) {
+            std::vector<T> vector(input.begin(), input.end());
+            {
+                CScopeProfiler profiler(pattern + "_vector_radix_sort");
+                radix_sort(vector);
+            }
+            verify(vector, pattern + "_vector_radix_sort");
+        }
+        {
+            std::vector<T> vector(input.begin(), input.end());
+            {
+                CScopeProfiler profiler(pattern + "_vector_parallel_sort(" + std::to_string(thread_count) + "スレッド)");
+                parallel_sort(vector, thread_count);
+            }
+            verify(vector, pattern + "_vector_parallel_sort");
+        }
+    }
+}
+
+// ===== 探索ワークロード =====
+/**
+ * @brief 分岐のない二分探索（lower_bound と同じ結果の位置を返す）
+ *
+ * 比較結果を条件付き移動で反映するため、分岐予測ミスが発生しません。
+ */
+template<typename T>
+size_t branchless_lower_bound(const T* first, size_t count, T key) {
+    if (count == 0) {
+        return 0;
+    }
+    const T* base = first;
+    while (count > 1) {
+        const size_t half = count / 2;
+        base = (base[half] < key) ? base + half : base;
+        count -= half;
+    }
+    return static_cast<size_t>(base - first) + (*base < key ? 1 : 0);
+}
+
+/**
+ * @brief Eytzinger（幅優先順）レイアウトの探索用配列
+ *
+ * ソート済み配列を完全二分木の幅優先順に並べ替えます（添字 1 が根、k の子は 2k / 2k+1）。
+ * 探索経路上のノードが先頭付近に集まり、数段先の子孫をまとめてプリフェッチできるため、
+ * 大きな配列で通常の二分探索よりキャッシュミスが減ります。
+ */
+template<typename T>
+class CEytzingerArray final {
+public:
+    /**
+     * @param sorted 昇順に整列済みのデータ
+     */
+    explicit CEytzingerArray(const std::vector<T>& sorted) : m_nodes(sorted.size() + 1) {
+        size_t next = 0;
+        build(sorted, next, 1);
+    }
+
+    /**
+     * @brief key 以上の最小要素へのポインタを返す（存在しなければ nullptr）
+     */
+    const T* lower_bound(T key) const {
+        const size_t n = m_nodes.size() - 1;
+        size_t k = 1;
+        while (k <= n) {
+            __builtin_prefetch(m_nodes.data() + std::min(k * PrefetchStride, n));  // 4 段先の子孫を先読み
+            k = 2 * k + (m_nodes[k] < key ? 1 : 0);
+        }
+        // 最後に左へ進んだ位置まで戻る（末尾の 1 の並びと、その直前の 0 を取り除く）
+        k >>= __builtin_ctzll(~static_cast<unsigned long long>(k)) + 1;
+        return k == 0 ? nullptr : &m_nodes[k];
+    }
+
+private:
+    static constexpr size_t PrefetchStride = 16;  // 4 段下のノード番号は 16k〜
+
+    /**
+     * @brief 中間順の走査で sorted の値を順に配置する
+     */
+    void build(const std::vector<T>& sorted, size_t& next, size_t k) {
+        if (k < m_nodes.size()) {
+            build(sorted, next, 2 * k);
+            m_nodes[k] = sorted[next++];
+            build(sorted, next, 2 * k + 1);
+        }
+    }
+
+    std::vector<T> m_nodes;  // 添字 0 は未使用
+};
+
+/**
+ * @brief ソート済みデータに対する探索を計測する
+ *
+ * クエリは元データと同じ乱数列の仕様で生成し（シードは元データ + 1）、偶数番目はデータ中の値（必ず見つかる）、
+ * 奇数番目はデータの実際の最小〜最大を上下に 10% 広げた範囲の一様乱数（見つからないケースを含む）です。
+ * `--input` の値がまばらでも find が毎回ミスにはなりません。
+ * 結果の値の合計を表示し、各方式が同じ答えを返すことを確認できます。
+ * 線形探索は 1 クエリが O(N) なので `LinearSearchQueries` 件だけ実行します。
+ */
+template<typename Source>
+void run_search_benchmark(const Source& src_array, std::uint64_t seed) {
+    using T = typename Source::value_type;
+    std::cout << "\n● 探索性能（ソート済みデータ）\n";
+
+    if (src_array.empty()) {
+        return;
+    }
+    std::vector<T> vector(src_array.begin(), src_array.end());
+    std::sort(vector.begin(), vector.end());
+    const std::deque<T> deque(vector.begin(), vector.end());
+    const std::list<T> list(vector.begin(), vector.end());
+    CUnrolledList<T> unrolled;
+    std::copy(vector.begin(), vector.end(), std::back_inserter(unrolled));
+    CRingBuffer<T> ring(vector.size());
+    std::copy(vector.begin(), vector.end(), std::back_inserter(ring));
+    const CEytzingerArray<T> eytzinger(vector);
+
+    // 範囲は 64bit で広げてから T の表現範囲に収める
+    const auto front = static_cast<std::int64_t>(vector.front());
+    const auto back = static_cast<std::int64_t>(vector.back());
+    const std::int64_t margin = (back - front) / 10;
+    const std::int64_t query_min = std::max<std::int64_t>(front - margin, std::numeric_limits<T>::lowest());
+    const std::int64_t query_max = std::min<std::int64_t>(back + margin, std::numeric_limits<T>::max());
+    std::mt19937 random_engine(fold_seed(seed + 1));
+    std::vector<T> queries(BenchmarkConfig::SearchQueries);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        queries[i] = i % 2 == 0 ? vector[draw_uniform_int(random_engine, size_t{0}, vector.size() - 1)]
+                                : static_cast<T>(draw_uniform_int(random_engine, query_min, query_max));
+    }
+
+    // クエリ列を流して 1 件あたりの時間と結果の合計（見つからなければ 0 として加算）を表示する
+    auto measure = [](const std::string& label, const std::vector<T>& query_stream, size_t count, auto&& search) {
+        std::int64_t total = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i) {
+            total += search(query_stream[i]);
+        }
+        const double ns_per_query = elapsed_milliseconds(start) * 1e6 / static_cast<double>(count);
+        std::cout << std::fixed << std::setprecision(2) << label << ": " << ns_per_query << " ns/クエリ (" << count
+                  << " 件, 結果合計 " << total << ")" << std::endl;
+    };
+    auto found_value = [](auto it, auto last) -> std::int64_t { return it == last ? 0 : static_cast<std::int64_t>(*it); };
+
+    const size_t linear_count = std::min(BenchmarkConfig::LinearSearchQueries, queries.size());
+    measure("vector_find", queries, linear_count, [&](T key) { return found_value(std::find(vector.begin(), vector.end(), key), vector.end()); });
+    measure("deque_find", queries, linear_count, [&](T key) { return found_value(std::find(deque.begin(), deque.end(), key), deque.end()); });
+    measure("ring_find", queries, linear_count, [&](T key) { return found_value(std::find(ring.begin(), ring.end(), key), ring.end()); });
+    measure("list_find", queries, linear_count, [&](T key) { return found_value(std::find(list.begin(), list.end(), key), list.end()); });
+    measure("unrolled_find", queries, linear_count,
+            [&](T key) { return found_value(std::find(unrolled.begin(), unrolled.end(), key), unrolled.end()); });
+
+    measure("vector_lower_bound", queries, queries.size(),
+            [&](T key) { return found_value(std::lower_bound(vector.begin(), vector.end(), key), vector.end()); });
+    measure("deque_lower_bound", queries, queries.size(),
+            [&](T key) { return found_value(std::lower_bound(deque.begin(), deque.end(), key), deque.end()); });
+    measure("ring_lower_bound", queries, queries.size(),
+            [&](T key) { return found_value(std::lower_bound(ring.begin(), ring.end(), key), ring.end()); });
+    measure("vector_branchless", queries, queries.size(), [&](T key) {
+        const size_t index = branchless_lower_bound(vector.data(), vector.size(), key);
+        return index == vector.size() ? std::int64_t{0} : static_cast<std::int64_t>(vector[index]);
+    });
+    measure("eytzinger", queries, queries.size(), [&](T key) {
+        const T* found = eytzinger.lower_bound(key);
+        return found == nullptr ? std::int64_t{0} : static_cast<std::int64_t>(*found);
+    });
+}
+
+// ===== キューシミュレーション =====
+/**
+ * @brief std::vector 上に構築した可変長リングバッファの FIFO キュー
+ *
+ * 容量は 2 のべき乗に保ち、添字はマスクで折り返します。満杯になったら容量を倍にして
+ * 先頭から詰め直すため、定常状態では確保も解放も発生しません。
+ */
+template<typename T>
+class CVectorRingQueue final {
+public:
+    using value_type = T;
+
+    void push_back(const T& value) {
+        if (m_size == m_slots.size()) {
+            grow();
+        }
+        m_slots[(m_head + m_size) & m_mask] = value;
+        ++m_size;
+    }
+
+    void pop_front() {
+        m_head = (m_head + 1) & m_mask;
+        --m_size;
+    }
+
+    const T& front() const { return m_slots[m_head]; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+private:
+    /**
+     * @brief 容量を倍にし、要素を先頭から詰め直す
+     */
+    void grow() {
+        std::vector<T> slots(m_slots.empty() ? 16 : m_slots.size() * 2);
+        for (size_t i = 0; i < m_size; ++i) {
+            slots[i] = m_slots[(m_head + i) & m_mask];
+        }
+        m_slots.swap(slots);
+        m_mask = m_slots.size() - 1;
+        m_head = 0;
+    }
+
+    std::vector<T> m_slots;  // 要素の格納領域（容量は 2 のべき乗）
+    size_t m_mask = 0;       // 容量 - 1
+    size_t m_head = 0;       // 先頭要素の位置
+    size_t m_size = 0;       // 要素数
+};
+
+/**
+ * @brief 目標深さを保ちながら push_back / pop_front を繰り返す FIFO ワークロードを計測する
+ *
+ * 操作列は全キューで共通です。深さが目標 ±25% の範囲内なら `QueuePushRatio` の確率で push、
+ * 範囲を外れたら深さを戻す方向の操作を選びます。まず操作列全体の時間を計測し、続けて
+ * 1 操作ずつ steady_clock で計測して push / pop 別の百分位数を表示します（時計の呼び出しコストを含む）。
+ */
+template<typename Source>
+void run_queue_benchmark(const Source& src_array, std::uint64_t seed) {
+    using T = typename Source::value_type;
+    std::cout << "\n● キューシミュレーション（深さ " << BenchmarkConfig::QueueTargetDepth << " を維持, "
+              << BenchmarkConfig::QueueOperations << " 操作）\n";
+    if (src_array.empty()) {
+        return;
+    }
+
+    // ----- 共通の操作列（true = push）を生成 -----
+    const size_t target = BenchmarkConfig::QueueTargetDepth;
+    const size_t band = target / 4;
+    std::mt19937 random_engine(fold_seed(seed + 2));
+    std::bernoulli_distribution choose_push(BenchmarkConfig::QueuePushRatio);
+    std::vector<bool> operations(BenchmarkConfig::QueueOperations);
+    size_t depth = target;
+    for (size_t i = 0; i < operations.size(); ++i) {
+        const bool push = depth + band < target || (depth <= target + band && choose_push(random_engine));
+        operations[i] = push;
+        depth = push ? depth + 1 : depth - 1;
+    }
+
+    // 時計の呼び出しコスト（1 回分）の目安
+    const auto overhead_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 1000; ++i) {
+        (void)std::chrono::steady_clock::now();
+    }
+    std::cout << std::fixed << std::setprecision(1) << "steady_clock::now() の呼び出しコスト: "
+              << elapsed_milliseconds(overhead_start) * 1e6 / 1000.0 << " ns\n";
+
+    // push / pop の操作を受け取り、スループットと操作ごとの遅延を計測する
+    auto simulate = [&](auto queue, const std::string& name, auto&& push, auto&& pop) {
+        size_t next = 0;
+        auto next_value = [&]() {
+            const T value = src_array.data()[next];
+            next = next + 1 == src_array.size() ? 0 : next + 1;
+            return value;
+        };
+        for (size_t i = 0; i < target; ++i) {
+            push(queue, next_value());
+        }
+        volatile T sink{};
+        {
+            CScopeProfiler profiler(name);
+            for (const bool op : operations) {
+                if (op) {
+                    push(queue, next_value());
+                } else {
+                    sink = pop(queue);
+                }
+            }
+        }
+        std::vector<std::int64_t> push_ns;
+        std::vector<std::int64_t> pop_ns;
+        push_ns.reserve(operations.size());
+        pop_ns.reserve(operations.size());
+        for (const bool op : operations) {
+            const auto start = std::chrono::steady_clock::now();
+            if (op) {
+                push(queue, next_value());
+            } else {
+                sink = pop(queue);
+            }
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            (op ? push_ns : pop_ns).push_back(ns);
+        }
+        (void)sink;
+        for (auto* samples : {&push_ns, &pop_ns}) {
+            const char* kind = samples == &push_ns ? "push" : "pop";
+            const std::int64_t p50 = percentile(*samples, 0.50);
+            const std::int64_t p99 = percentile(*samples, 0.99);
+            const std::int64_t p999 = percentile(*samples, 0.999);
+            const std::int64_t max = percentile(*samples, 1.0);
+            std::cout << "  " << name << " " << kind << ": p50 " << p50 << " ns / p99 " << p99 << " ns / p99.9 " << p999
+                      << " ns / 最大 " << max << " ns" << std::endl;
+        }
+    };
+    auto push_back = [](auto& queue, T value) { queue.push_back(value); };
+    auto pop_front = [](auto& queue) {
+        const T value = queue.front();
+        queue.pop_front();
+        return value;
+    };
+    auto adapter_push = [](auto& queue, T value) { queue.push(value); };
+    auto adapter_pop = [](auto& queue) {
+        const T value = queue.front();
+        queue.pop();
+        return value;
+    };
+    simulate(std::deque<T>(), "deque", push_back, pop_front);
+    simulate(std::list<T>(), "list", push_back, pop_front);
+    simulate(CUnrolledList<T>(), "unrolled", push_back, pop_front);
+    simulate(CVectorRingQueue<T>(), "vectorリングバッファ", push_back, pop_front);
+    simulate(CRingBuffer<T>(2 * target), "固定容量ring", push_back, pop_front);
+    simulate(std::queue<T>(), "queue<deque>", adapter_push, adapter_pop);
+    simulate(std::queue<T, std::list<T>>(), "queue<list>", adapter_push, adapter_pop);
+}
+
+// ===== ブロックサイズ可変の両端キュー =====
+/**
+ * @brief ブロックのバイト数をテンプレート引数で指定できる両端キュー
+ *
+ * libstdc++ の std::deque と同じく、固定長ブロックへのポインタ配列（マップ）で要素を管理します。
+ * 1 ブロックの要素数は `BlockBytes / sizeof(T)`（最低 1）です。末尾の次の位置を含むブロックを常に
+ * 確保しておくため、イテレータは現在のブロックの範囲だけを見て進められます。マップの端に達したら、
+ * 使用中のブロックを中央へ寄せ直すか、マップを倍に広げます。空になったブロックはすぐに解放します。
+ */
+template<typename T, size_t BlockBytes>
+class CBlockDeque final {
+public:
+    static constexpr size_t BlockSize = BlockBytes / sizeof(T) > 0 ? BlockBytes / sizeof(T) : 1;  // 1 ブロックの要素数
+
+private:
+    /**
+     * @brief 現在位置・ブロック範囲・マップ位置を保持するランダムアクセスイテレータ
+     */
+    template<bool IsConst>
+    class Iterator final {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() = default;
+        Iterator(T* const* node, T* current) : m_current(current), m_first(*node), m_last(*node + BlockSize), m_node(node) {}
+        // 非 const から const への変換
+        template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        Iterator(const Iterator<OtherConst>& other)
+            : m_current(other.m_current), m_first(other.m_first), m_last(other.m_last), m_node(other.m_node) {}
+
+        reference operator*() const { return *m_current; }
+        pointer operator->() const { return m_current; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        Iterator& operator++() {
+            if (++m_current == m_last) {
+                set_node(m_node + 1);
+                m_current = m_first;
+            }
+            return *this;
+        }
+        Iterator operator++(int) { Iterator old = *this; ++*this; return old; }
+        Iterator& operator--() {
+            if (m_current == m_first) {
+                set_node(m_node - 1);
+                m_current = m_last;
+            }
+            --m_current;
+            return *this;
+        }
+        Iterator operator--(int) { Iterator old = *this; --*this; return old; }
+        Iterator& operator+=(difference_type n) {
+            const difference_type block = static_cast<difference_type>(BlockSize);
+            const difference_type offset = n + (m_current - m_first);
+            if (offset >= 0 && offset < block) {
+                m_current += n;
+            } else {
+                const difference_type node_offset = offset > 0 ? offset / block : -((-offset - 1) / block) - 1;
+                set_node(m_node + node_offset);
+                m_current = m_first + (offset - node_offset * block);
+            }
+            return *this;
+        }
+        Iterator& operator-=(difference_type n) { return *this += -n; }
+        friend Iterator operator+(Iterator it, difference_type n) { return it += n; }
+        friend Iterator operator+(difference_type n, Iterator it) { return it += n; }
+        friend Iterator operator-(Iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const Iterator& a, const Iterator& b) {
+            return static_cast<difference_type>(BlockSize) * (a.m_node - b.m_node) + (a.m_current - a.m_first) - (b.m_current - b.m_first);
+        }
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.m_current == b.m_current; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.m_current != b.m_current; }
+        friend bool operator<(const Iterator& a, const Iterator& b) {
+            return a.m_node == b.m_node ? a.m_current < b.m_current : a.m_node < b.m_node;
+        }
+        friend bool operator>(const Iterator& a, const Iterator& b) { return b < a; }
+        friend bool operator<=(const Iterator& a, const Iterator& b) { return !(b < a); }
+        friend bool operator>=(const Iterator& a, const Iterator& b) { return !(a < b); }
+
+    private:
+        friend class Iterator<!IsConst>;
+
+        void set_node(T* const* node) {
+            m_node = node;
+            m_first = *node;
+            m_last = *node + BlockSize;
+        }
+
+        T* m_current = nullptr;       // 現在の要素
+        T* m_first = nullptr;         // 現在のブロックの先頭
+        T* m_last = nullptr;          // 現在のブロックの末尾（含まない）
+        T* const* m_node = nullptr;   // マップ上の現在のブロック
+    };
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    CBlockDeque() { initialize(); }
+    ~CBlockDeque() { release(); }
+
+    CBlockDeque(const CBlockDeque&) = delete;
+    CBlockDeque& operator=(const CBlockDeque&) = delete;
+
+    void push_back(const T& value) {
+        (*this)[m_size] = value;
+        if ((m_start + m_size + 1) / BlockSize == m_map.size()) {
+            reserve_map();
+        }
+        ++m_size;
+        allocate_block((m_start + m_size) / BlockSize);
+    }
+
+    void push_front(const T& value) {
+        if (m_start == 0) {
+            reserve_map();
+        }
+        --m_start;
+        allocate_block(m_start / BlockSize);
+        ++m_size;
+        (*this)[0] = value;
+    }
+
+    void pop_front() {
+        ++m_start;
+        --m_size;
+        if (m_start % BlockSize == 0) {
+            free_block(m_start / BlockSize - 1);
+        }
+    }
+
+    void pop_back() {
+        const size_t old_end_block = (m_start + m_size) / BlockSize;
+        --m_size;
+        if ((m_start + m_size) / BlockSize != old_end_block) {
+            free_block(old_end_block);
+        }
+    }
+
+    void clear() {
+        release();
+        initialize();
+    }
+
+    T& operator[](size_t index) {
+        const size_t position = m_start + index;
+        return m_map[position / BlockSize][position % BlockSize];
+    }
+    const T& operator[](size_t index) const {
+        const size_t position = m_start + index;
+        return m_map[position / BlockSize][position % BlockSize];
+    }
+    T& front() { return (*this)[0]; }
+    const T& front() const { return (*this)[0]; }
+    T& back() { return (*this)[m_size - 1]; }
+    const T& back() const { return (*this)[m_size - 1]; }
+
+    iterator begin() { return make_iterator<iterator>(m_start); }
+    iterator end() { return make_iterator<iterator>(m_start + m_size); }
+    const_iterator begin() const { return make_iterator<const_iterator>(m_start); }
+    const_iterator end() const { return make_iterator<const_iterator>(m_start + m_size); }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+private:
+    template<typename It>
+    It make_iterator(size_t position) const {
+        T* const* node = m_map.data() + position / BlockSize;
+        return It(node, *node + position % BlockSize);
+    }
+
+    void initialize() {
+        m_map.assign(8, nullptr);
+        m_start = m_map.size() / 2 * BlockSize;
+        m_size = 0;
+        allocate_block(m_start / BlockSize);
+    }
+
+    void release() {
+        for (T* block : m_map) {
+            delete[] block;
+        }
+        m_map.clear();
+    }
+
+    void allocate_block(size_t block) {
+        if (m_map[block] == nullptr) {
+            m_map[block] = new T[BlockSize];
+        }
+    }
+
+    void free_block(size_t block) {
+        delete[] m_map[block];
+        m_map[block] = nullptr;
+    }
+
+    /**
+     * @brief マップの両端に空きを作る（使用中ブロックを中央へ寄せ、足りなければマップを倍にする）
+     */
+    void reserve_map() {
+        const size_t first_block = m_start / BlockSize;
+        const size_t used_blocks = (m_start + m_size) / BlockSize - first_block + 1;
+        const size_t new_size = m_map.size() >= 2 * used_blocks + 2 ? m_map.size() : 2 * m_map.size() + 2;
+        std::vector<T*> map(new_size, nullptr);
+        const size_t new_first = (new_size - used_blocks) / 2;
+        std::copy(m_map.begin() + static_cast<std::ptrdiff_t>(first_block),
+                  m_map.begin() + static_cast<std::ptrdiff_t>(first_block + used_blocks), map.begin() + static_cast<std::ptrdiff_t>(new_first));
+        m_map.swap(map);
+        m_start = new_first * BlockSize + m_start % BlockSize;
+    }
+
+    std::vector<T*> m_map;  // ブロックへのポインタ配列（未使用は nullptr）
+    size_t m_start = 0;     // 先頭要素のマップ上の通し位置
+    size_t m_size = 0;      // 要素数
+};
+
+/**
+ * @brief ブロックサイズ 512 B〜64 KB の CBlockDeque と std::deque を比較する
+ *
+ * 各ブロックサイズについて、コピー（push_back）・シーケンシャル読み取り・添字によるランダムアクセス
+ * （`BlockDequeRandomReads` 回）・push_front を計測します。std::deque（libstdc++ は 512 B ブロック）が基準です。
+ */
+template<typename Source>
+void run_block_deque_benchmark(const Source& src_array, std::uint64_t seed) {
+    using T = typename Source::value_type;
+    std::cout << "\n● deque のブロックサイズ比較（ランダムアクセス " << BenchmarkConfig::BlockDequeRandomReads << " 回）\n";
+    std::mt19937 random_engine(fold_seed(seed + 3));
+    std::vector<size_t> indices(src_array.empty() ? 0 : BenchmarkConfig::BlockDequeRandomReads);
+    std::generate(indices.begin(), indices.end(), [&]() { return draw_uniform_int(random_engine, size_t{0}, src_array.size() - 1); });
+
+    auto measure = [&](auto&& deque, const std::string& name) {
+        {
+            CScopeProfiler profiler(name + "_copy");
+            std::copy(src_array.begin(), src_array.end(), std::back_inserter(deque));
+        }
+        if (!std::equal(deque.begin(), deque.end(), src_array.begin(), src_array.end())) {
+            std::cerr << "警告: " << name << " の内容が元データと一致しません\n";
+        }
+        {
+            CScopeProfiler profiler(name + "_read");
+            read_container(deque);
+        }
+        {
+            std::int64_t total = 0;
+            {
+                CScopeProfiler profiler(name + "_random_access");
+                for (const size_t index : indices) {
+                    total += deque[index];
+                }
+            }
+            std::cout << name << " ランダムアクセスの合計: " << total << std::endl;
+        }
+        deque.clear();
+        {
+            CScopeProfiler profiler(name + "_push_front");
+            for (const auto& value : src_array) {
+                deque.push_front(value);
+            }
+        }
+    };
+    measure(std::deque<T>(), "std::deque");
+    auto sweep = [&](auto... block_bytes) {
+        (measure(CBlockDeque<T, decltype(block_bytes)::value>(), "deque<" + std::to_string(decltype(block_bytes)::value) + "B>"), ...);
+    };
+    sweep(std::integral_constant<size_t, 512>{}, std::integral_constant<size_t, 1024>{}, std::integral_constant<size_t, 4096>{},
+          std::integral_constant<size_t, 16384>{}, std::integral_constant<size_t, 65536>{});
+}
+
+// ===== インライン容量付き vector =====
+/**
+ * @brief 先頭 N 要素をオブジェクト内に格納する可変長配列（small vector）
+ *
+ * 要素数が N 以下の間はヒープ確保を行わず、オブジェクト内の領域を使います。N を超えると
+ * std::vector と同じく容量を倍にしながらヒープへ移ります。小さな列を大量に持つ場合に、
+ * コンテナごとのヒープ確保とポインタ追跡をなくせます。ムーブは可能、コピーは不可です。
+ */
+template<typename T, size_t N>
+class CSmallVector final {
+    static_assert(N > 0, "インライン容量 N は 1 以上にしてください");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    CSmallVector() = default;
+    ~CSmallVector() {
+        clear();
+        release();
+    }
+
+    CSmallVector(const CSmallVector&) = delete;
+    CSmallVector& operator=(const CSmallVector&) = delete;
+    CSmallVector(CSmallVector&& other) noexcept { take(other); }
+    CSmallVector& operator=(CSmallVector&& other) noexcept {
+        if (this != &other) {
+            clear();
+            release();
+            take(other);
+        }
+        return *this;
+    }
+
+    void push_back(const T& value) {
+        if (m_size == m_capacity) {
+            grow(2 * m_capacity);
+        }
+        new (m_data + m_size) T(value);
+        ++m_size;
+    }
+
+    void pop_back() { m_data[--m_size].~T(); }
+
+    void reserve(size_t capacity) {
+        if (capacity > m_capacity) {
+            grow(capacity);
+        }
+    }
+
+    void clear() {
+        std::destroy(m_data, m_data + m_size);
+        m_size = 0;
+    }
+
+    T& operator[](size_t index) { return m_data[index]; }
+    const T& operator[](size_t index) const { return m_data[index]; }
+
+    T* data() { return m_data; }
+    const T* data() const { return m_data; }
+    iterator begin() { return m_data; }
+    iterator end() { return m_data + m_size; }
+    const_iterator begin() const { return m_data; }
+    const_iterator end() const { return m_data + m_size; }
+
+    size_t size() const { return m_size; }
+    size_t capacity() const { return m_capacity; }
+    bool empty() const { return m_size == 0; }
+    bool is_inline() const { return m_data == inline_data(); }
+
+private:
+    T* inline_data() { return std::launder(reinterpret_cast<T*>(m_inline)); }
+    const T* inline_data() const { return std::launder(reinterpret_cast<const T*>(m_inline)); }
+
+    void grow(size_t capacity) {
+        T* heap = static_cast<T*>(::operator new(capacity * sizeof(T)));
+        std::uninitialized_move(m_data, m_data + m_size, heap);
+        std::destroy(m_data, m_data + m_size);
+        release();
+        m_data = heap;
+        m_capacity = capacity;
+    }
+
+    /**
+     * @brief ヒープ領域を解放してインライン領域へ戻す（要素は破棄済みであること）
+     */
+    void release() {
+        if (!is_inline()) {
+            ::operator delete(m_data);
+        }
+        m_data = inline_data();
+        m_capacity = N;
+    }
+
+    /**
+     * @brief other の要素を引き取る（ヒープ領域ならポインタごと、インラインなら要素をムーブ）
+     */
+    void take(CSmallVector& other) noexcept {
+        if (other.is_inline()) {
+            std::uninitialized_move(other.m_data, other.m_data + other.m_size, m_data);
+            m_size = other.m_size;
+            other.clear();
+            return;
+        }
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        other.m_data = other.inline_data();
+        other.m_size = 0;
+        other.m_capacity = N;
+    }
+
+    alignas(T) unsigned char m_inline[N * sizeof(T)];  // インライン領域
+    T* m_data = inline_data();                         // 現在の格納領域（インライン または ヒープ）
+    size_t m_size = 0;                                 // 要素数
+    size_t m_capacity = N;                             // 現在の容量
+};
+
+/**
+ * @brief 要素数 0〜`SmallContainerMaxSize` の小さなコンテナを `SmallContainerCount` 個扱う
+ *
+ * 各コンテナ型について、全コンテナの構築（要素の追加を含む）・全要素の走査・破棄を個別に計測します。
+ * 大きな 1 つのコンテナを扱う run() と異なり、コンテナごとのヒープ確保と解放が支配的になる領域です。
+ * CSmallVector のインライン容量は `SmallVectorInline` で、それを超えたコンテナだけがヒープを使います。
+ */
+template<typename Source>
+void run_small_container_benchmark(const Source& src_array, std::uint64_t seed) {
+    using T = typename Source::value_type;
+    if (src_array.empty()) {
+        return;
+    }
+    std::mt19937 random_engine(fold_seed(seed + 4));
+    std::vector<size_t> sizes(BenchmarkConfig::SmallContainerCount);
+    std::generate(sizes.begin(), sizes.end(),
+                  [&]() { return draw_uniform_int(random_engine, size_t{0}, BenchmarkConfig::SmallContainerMaxSize); });
+    const auto spilled = std::count_if(sizes.begin(), sizes.end(), [](size_t size) { return size > BenchmarkConfig::SmallVectorInline; });
+    std::cout << "\n● 小さなコンテナの大量生成（" << sizes.size() << " 個, 各 0〜" << BenchmarkConfig::SmallContainerMaxSize
+              << " 要素, インライン容量超え " << spilled << " 個）\n";
+
+    auto measure = [&](auto empty, const std::string& name) {
+        using Container = decltype(empty);
+        std::vector<Container> containers;
+        containers.reserve(sizes.size());
+        {
+            CScopeProfiler profiler(name + "_構築");
+            size_t next = 0;
+            for (const size_t size : sizes) {
+                containers.emplace_back();
+                Container& container = containers.back();
+                for (size_t k = 0; k < size; ++k) {
+                    container.push_back(src_array.data()[next]);
+                    next = next + 1 == src_array.size() ? 0 : next + 1;
+                }
+            }
+        }
+        std::int64_t total = 0;
+        {
+            CScopeProfiler profiler(name + "_走査");
+            for (const auto& container : containers) {
+                for (const auto& value : container) {
+                    total += value;
+                }
+            }
+        }
+        {
+            CScopeProfiler profiler(name + "_破棄");
+            containers.clear();
+        }
+        std::cout << name << " の要素合計: " << total << " (sizeof " << sizeof(Container) << " バイト)" << std::endl;
+    };
+    measure(CSmallVector<T, BenchmarkConfig::SmallVectorInline>(), "small_vector");
+    measure(std::vector<T>(), "vector");
+    measure(std::deque<T>(), "deque");
+    measure(std::list<T>(), "list");
+}
+
+// ===== AoS と SoA =====
+/**
+ * @brief 整数の和と二乗和による平均・分散の集計（1 フィールド分）
+ *
+ * 除算を含む Welford 更新と違い加算だけなので、メモリ帯域の差がそのまま時間に表れます。
+ * 32bit 値の二乗は数件の累積で int64 を超え得るため、二乗和は Int128 で累積します。
+ */
+struct FieldMoments {
+    std::int64_t count = 0;  // 要素数
+    std::int64_t sum = 0;    // 和
+    Int128 sum_squares = 0;  // 二乗和
+
+    void add(std::int64_t value) {
+        ++count;
+        sum += value;
+        sum_squares += static_cast<Int128>(value) * value;
+    }
+
+    double mean() const { return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count); }
+    double variance() const {
+        if (count == 0) {
+            return 0.0;
+        }
+        // n·Σx² − (Σx)² を整数で正確に求めてから割ることで、平均が大きいときの桁落ちを避けます
+        const Int128 numerator = sum_squares * count - static_cast<Int128>(sum) * sum;
+        return static_cast<double>(numerator) / (static_cast<double>(count) * static_cast<double>(count));
+    }
+};
+
+/**
+ * @brief Record をフィールドごとの std::vector に分けて持つ SoA（Structure of Arrays）コンテナ
+ */
+class CRecordColumns final {
+public:
+    using Record = BenchmarkConfig::Record;
+
+    void reserve(size_t count) {
+        for (auto& column : m_columns) {
+            column.reserve(count);
+        }
+    }
+
+    void push_back(const Record& record) {
+        for (size_t f = 0; f < BenchmarkConfig::RecordFields; ++f) {
+            m_columns[f].push_back(record.fields[f]);
+        }
+    }
+
+    const std::vector<BenchmarkConfig::DataType>& column(size_t field) const { return m_columns[field]; }
+    size_t size() const { return m_columns[0].size(); }
+
+private:
+    std::array<std::vector<BenchmarkConfig::DataType>, BenchmarkConfig::RecordFields> m_columns;  // フィールドごとの列
+};
+
+/**
+ * @brief std::vector<Record>（AoS）と CRecordColumns（SoA）を集計クエリで比較する
+ *
+ * 元データと同数のレコードを作り、1 フィールドだけの平均・分散、全フィールドの平均・分散、
+ * フィールド 1 が正のレコードに絞ったフィールド 2 の平均・分散を計測します。AoS は 1 フィールドを
+ * 読むだけでもレコード全体（`RecordFields` 個分）のキャッシュラインを転送します。
+ */
+template<typename Source>
+void run_layout_benchmark(const Source& src_array) {
+    using Record = BenchmarkConfig::Record;
+    constexpr size_t fields = BenchmarkConfig::RecordFields;
+    std::cout << "\n● AoS と SoA（" << src_array.size() << " レコード x " << fields << " フィールド）\n";
+    if (src_array.empty()) {
+        return;
+    }
+
+    std::vector<Record> records;
+    CRecordColumns columns;
+    records.reserve(src_array.size());
+    columns.reserve(src_array.size());
+    for (size_t i = 0; i < src_array.size(); ++i) {
+        Record record;
+        for (size_t f = 0; f < fields; ++f) {
+            record.fields[f] = src_array.data()[(i * fields + f) % src_array.size()];
+        }
+        records.push_back(record);
+        columns.push_back(record);
+    }
+
+    auto print = [](const std::string& label, const FieldMoments& moments) {
+        std::cout << std::fixed << std::setprecision(3) << label << ": 平均 " << moments.mean() << " / 分散 " << moments.variance()
+                  << " (" << moments.count << " 件)" << std::endl;
+    };
+
+    // 1 フィールドだけの集計
+    {
+        FieldMoments moments;
+        {
+            CScopeProfiler profiler("AoS_1フィールド");
+            for (const auto& record : records) {
+                moments.add(record.fields[0]);
+            }
+        }
+        print("AoS フィールド0", moments);
+    }
+    {
+        FieldMoments moments;
+        {
+            CScopeProfiler profiler("SoA_1フィールド");
+            for (const auto value : columns.column(0)) {
+                moments.add(value);
+            }
+        }
+        print("SoA フィールド0", moments);
+    }
+
+    // 全フィールドの集計（最後のフィールドの結果を表示）
+    {
+        std::array<FieldMoments, fields> moments{};
+        {
+            CScopeProfiler profiler("AoS_全フィールド");
+            for (const auto& record : records) {
+                for (size_t f = 0; f < fields; ++f) {
+                    moments[f].add(record.fields[f]);
+                }
+            }
+        }
+        print("AoS フィールド" + std::to_string(fields - 1), moments.back());
+    }
+    {
+        std::array<FieldMoments, fields> moments{};
+        {
+            CScopeProfiler profiler("SoA_全フィールド");
+            for (size_t f = 0; f < fields; ++f) {
+                for (const auto value : columns.column(f)) {
+                    moments[f].add(value);
+                }
+            }
+        }
+        print("SoA フィールド" + std::to_string(fields - 1), moments.back());
+    }
+
+    // 絞り込み後の集計: フィールド 1 が正のレコードについてフィールド 2 を集計
+    {
+        FieldMoments moments;
+        {
+            CScopeProfiler profiler("AoS_絞り込み集計");
+            for (const auto& record : records) {
+                if (record.fields[1] > 0) {
+                    moments.add(record.fields[2]);
+                }
+            }
+        }
+        print("AoS 絞り込み", moments);
+    }
+    {
+        FieldMoments moments;
+        {
+            CScopeProfiler profiler("SoA_絞り込み集計");
+            const auto& filter = columns.column(1);
+            const auto& target = columns.column(2);
+            for (size_t i = 0; i < columns.size(); ++i) {
+                if (filter[i] > 0) {
+                    moments.add(target[i]);
+                }
+            }
+        }
+        print("SoA 絞り込み", moments);
+    }
+}
+
+// ===== 侵入型リスト =====
+/**
+ * @brief 侵入型リストのリンク（要素側に埋め込む）
+ */
+struct IntrusiveLink {
+    IntrusiveLink* prev = nullptr;  // 前のリンク
+    IntrusiveLink* next = nullptr;  // 次のリンク
+};
+
+/**
+ * @brief リンクと値をまとめた侵入型リストの要素
+ *
+ * リンクを先頭メンバに置くため、リンクのアドレスから要素を復元できます。
+ */
+template<typename T>
+struct IntrusiveNode {
+    IntrusiveLink link;  // リストへのリンク（先頭メンバ）
+    T value{};           // 値
+};
+
+/**
+ * @brief 侵入型リスト用のノードを連続領域から払い出すプール
+ *
+ * 容量分のノードをコンストラクタで一括確保し、`acquire` は未使用ノードを 1 つ返すだけです。
+ * 返却されたノードはリンクを流用した空きリストで再利用します。容量を超えると std::length_error を送出します。
+ */
+template<typename T>
+class CNodePool final {
+public:
+    explicit CNodePool(size_t capacity) : m_nodes(std::make_unique<IntrusiveNode<T>[]>(capacity)), m_capacity(capacity) {}
+
+    CNodePool(const CNodePool&) = delete;
+    CNodePool& operator=(const CNodePool&) = delete;
+
+    IntrusiveNode<T>& acquire(const T& value) {
+        IntrusiveNode<T>* node = nullptr;
+        if (m_free != nullptr) {
+            node = reinterpret_cast<IntrusiveNode<T>*>(m_free);
+            m_free = m_free->next;
+        } else if (m_used < m_capacity) {
+            node = &m_nodes[m_used++];
+        } else {
+            throw std::length_error("CNodePool の容量を超えてノードを取得しようとしました");
+        }
+        node->value = value;
+        return *node;
+    }
+
+    /**
+     * @brief リストから外したノードを返却する
+     */
+    void release(IntrusiveNode<T>& node) {
+        node.link.next = m_free;
+        m_free = &node.link;
+    }
+
+private:
+    std::unique_ptr<IntrusiveNode<T>[]> m_nodes;  // ノードの格納領域
+    size_t m_capacity = 0;                        // ノード数
+    size_t m_used = 0;                            // 一度でも払い出したノード数
+    IntrusiveLink* m_free = nullptr;              // 返却済みノードの空きリスト
+};
+
+/**
+ * @brief 要素に埋め込んだリンクで繋ぐ双方向の侵入型リスト（番兵付きの循環リスト）
+ *
+ * ノードの確保・解放を行わず、呼び出し側（CNodePool など）が用意したノードを繋ぐだけです。
+ * そのため追加・削除・splice はいずれもポインタの付け替えのみで、ヒープ確保は発生しません。
+ * イテレータは値（`T&`）を返すので、std::list と同じ集計ヘルパーをそのまま使えます。
+ * 番兵がオブジェクト内にあるため、コピー・ムーブはできません。
+ */
+template<typename T>
+class CIntrusiveList final {
+    template<bool IsConst>
+    class Iterator final {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using Link = std::conditional_t<IsConst, const IntrusiveLink, IntrusiveLink>;
+        using Node = std::conditional_t<IsConst, const IntrusiveNode<T>, IntrusiveNode<T>>;
+
+        Iterator() = default;
+        explicit Iterator(Link* link) : m_link(link) {}
+        // 非 const から const への変換
+        template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        Iterator(const Iterator<OtherConst>& other) : m_link(other.m_link) {}
+
+        reference operator*() const { return reinterpret_cast<Node*>(m_link)->value; }
+        pointer operator->() const { return &**this; }
+
+        Iterator& operator++() { m_link = m_link->next; return *this; }
+        Iterator operator++(int) { Iterator old = *this; m_link = m_link->next; return old; }
+        Iterator& operator--() { m_link = m_link->prev; return *this; }
+        Iterator operator--(int) { Iterator old = *this; m_link = m_link->prev; return old; }
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.m_link == b.m_link; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.m_link != b.m_link; }
+
+    private:
+        friend class Iterator<!IsConst>;
+        friend class CIntrusiveList;
+        Link* m_link = nullptr;  // 現在のリンク（end なら番兵）
+    };
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    CIntrusiveList() { m_sentinel.prev = m_sentinel.next = &m_sentinel; }
+
+    CIntrusiveList(const CIntrusiveList&) = delete;
+    CIntrusiveList& operator=(const CIntrusiveList&) = delete;
+
+    void push_back(IntrusiveNode<T>& node) { link_before(&m_sentinel, &node.link); }
+    void push_front(IntrusiveNode<T>& node) { link_before(m_sentinel.next, &node.link); }
+
+    /**
+     * @brief pos の要素をリストから外す（ノードの返却は呼び出し側が行う）
+     */
+    IntrusiveNode<T>& erase(const_iterator pos) {
+        IntrusiveLink* link = const_cast<IntrusiveLink*>(pos.m_link);
+        link->prev->next = link->next;
+        link->next->prev = link->prev;
+        --m_size;
+        return *reinterpret_cast<IntrusiveNode<T>*>(link);
+    }
+
+    /**
+     * @brief other の全要素を pos の直前へ移す（O(1)）
+     */
+    void splice(const_iterator pos, CIntrusiveList& other) {
+        if (other.empty() || &other == this) {
+            return;
+        }
+        IntrusiveLink* next = const_cast<IntrusiveLink*>(pos.m_link);
+        IntrusiveLink* first = other.m_sentinel.next;
+        IntrusiveLink* last = other.m_sentinel.prev;
+        first->prev = next->prev;
+        next->prev->next = first;
+        last->next = next;
+        next->prev = last;
+        m_size += other.m_size;
+        other.clear();
+    }
+
+    /**
+     * @brief すべての要素を外す（ノードには触れない）
+     */
+    void clear() {
+        m_sentinel.prev = m_sentinel.next = &m_sentinel;
+        m_size = 0;
+    }
+
+    T& front() { return *begin(); }
+    const T& front() const { return *begin(); }
+    T& back() { return *std::prev(end()); }
+    const T& back() const { return *std::prev(end()); }
+
+    iterator begin() { return iterator(m_sentinel.next); }
+    iterator end() { return iterator(&m_sentinel); }
+    const_iterator begin() const { return const_iterator(m_sentinel.next); }
+    const_iterator end() const { return const_iterator(&m_sentinel); }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+private:
+    void link_before(IntrusiveLink* next, IntrusiveLink* link) {
+        link->prev = next->prev;
+        link->next = next;
+        next->prev->next = link;
+        next->prev = link;
+        ++m_size;
+    }
+
+    IntrusiveLink m_sentinel;  // 番兵（先頭の前・末尾の次）
+    size_t m_size = 0;         // 要素数
+};
+
+/**
+ * @brief プールから払い出したノードを繋ぐ侵入型リストと std::list を比較する
+ *
+ * コピー（ノードの確保と連結）、シーケンシャル読み取り、平均値・分散、splice を計測します。
+ * 侵入型リストのプールはコピーの前に一括確保し、その時間は別に表示します。splice は後半のデータを
+ * 前半の中央へ移す処理で、挿入位置までの走査は計測に含めません。
+ */
+template<typename Source>
+void run_intrusive_list_benchmark(const Source& src_array) {
+    using T = typename Source::value_type;
+    std::cout << "\n● 侵入型リストと std::list\n";
+    const size_t half = src_array.size() / 2;
+
+    std::list<T> list;
+    {
+        CScopeProfiler profiler("list_copy");
+        std::copy(src_array.begin(), src_array.end(), std::back_inserter(list));
+    }
+    std::unique_ptr<CNodePool<T>> pool;
+    {
+        CScopeProfiler profiler("intrusive_プール確保");
+        pool = std::make_unique<CNodePool<T>>(src_array.size());
+    }
+    CIntrusiveList<T> intrusive;
+    {
+        CScopeProfiler profiler("intrusive_copy(link-in)");
+        for (const auto& value : src_array) {
+            intrusive.push_back(pool->acquire(value));
+        }
+    }
+
+    {
+        CScopeProfiler profiler("list_read");
+        read_container(list);
+    }
+    {
+        CScopeProfiler profiler("intrusive_read");
+        read_container(intrusive);
+    }
+
+    auto statistics = [](const auto& container, const std::string& name) {
+        CScopeProfiler profiler(name + "_平均値+分散");
+        const double avg = average(container);
+        const double var = variance(container);
+        std::cout << std::fixed << std::setprecision(3) << name << "の平均値/分散: " << avg << " / " << var << std::endl;
+    };
+    statistics(list, "list");
+    statistics(intrusive, "intrusive");
+
+    // 後半を別リストへ移し直し、前半の中央へ splice する
+    std::list<T> list_tail;
+    list_tail.splice(list_tail.end(), list, std::next(list.begin(), static_cast<std::ptrdiff_t>(half)), list.end());
+    CIntrusiveList<T> intrusive_tail;
+    while (intrusive.size() > half) {
+        intrusive_tail.push_front(intrusive.erase(std::prev(intrusive.end())));
+    }
+    const auto list_position = std::next(list.begin(), static_cast<std::ptrdiff_t>(half / 2));
+    const auto intrusive_position = std::next(intrusive.begin(), static_cast<std::ptrdiff_t>(half / 2));
+    {
+        CScopeProfiler profiler("list_splice");
+        list.splice(list_position, list_tail);
+    }
+    {
+        CScopeProfiler profiler("intrusive_splice");
+        intrusive.splice(intrusive_position, intrusive_tail);
+    }
+    if (!std::equal(list.begin(), list.end(), intrusive.begin(), intrusive.end())) {
+        std::cerr << "警告: splice 後の list と intrusive の内容が一致しません\n";
+    }
+}
+
+// ===== バケツ配列（colony 方式） =====
+/**
+ * @brief 削除済みスロットを飛ばして走査するバケツ配列（plf::colony / std::hive 方式）
+ *
+ * 要素は `BucketSize` スロットの固定長バケツに格納し、削除してもほかの要素を動かしません。
+ * そのため要素へのポインタ・イテレータは、その要素を削除するまで有効です。削除済みスロットの連続区間は
+ * 両端に区間長を書いたスキップフィールドで表し（jump-counting）、走査は区間を 1 回の加算で飛び越えます。
+ * 削除済み区間はバケツごとの双方向リストで管理し、挿入はまずその先頭スロットを再利用します。
+ * 空いたバケツは解放せずに保持します。
+ */
+template<typename T, size_t BucketSize = BenchmarkConfig::ColonyBucketSize>
+class CColony final {
+    static_assert(BucketSize >= 1 && BucketSize < 0xFFFF, "BucketSize は 1〜65534 にしてください");
+    using Slot = std::uint16_t;
+    static constexpr Slot NoRun = 0xFFFF;  // 区間リストの終端
+
+    struct Bucket {
+        std::array<T, BucketSize> values{};          // 要素（削除済みスロットの値は未使用）
+        std::array<Slot, BucketSize + 1> skip{};     // 削除済み区間の両端に区間長、生存スロットは 0（末尾は番兵）
+        std::array<Slot, BucketSize> run_prev{};     // 削除済み区間リスト（区間先頭のスロットで管理）
+        std::array<Slot, BucketSize> run_next{};
+        Slot run_head = NoRun;                       // 削除済み区間リストの先頭
+        size_t high = 0;                             // 一度でも使ったスロット数（走査の上限）
+
+        void add_run(Slot start) {
+            run_prev[start] = NoRun;
+            run_next[start] = run_head;
+            if (run_head != NoRun) {
+                run_prev[run_head] = start;
+            }
+            run_head = start;
+        }
+
+        void remove_run(Slot start) {
+            const Slot prev = run_prev[start];
+            const Slot next = run_next[start];
+            (prev != NoRun ? run_next[prev] : run_head) = next;
+            if (next != NoRun) {
+                run_prev[next] = prev;
+            }
+        }
+
+        // 区間の先頭が from から to へ移ったときにリスト上の位置を引き継ぐ
+        void move_run(Slot from, Slot to) {
+            const Slot prev = run_prev[from];
+            const Slot next = run_next[from];
+            run_prev[to] = prev;
+            run_next[to] = next;
+            (prev != NoRun ? run_next[prev] : run_head) = to;
+            if (next != NoRun) {
+                run_prev[next] = to;
+            }
+        }
+    };
+
+    /**
+     * @brief バケツ番号とスロットを保持する前方イテレータ
+     */
+    template<bool IsConst>
+    class Iterator final {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using Owner = std::conditional_t<IsConst, const CColony, CColony>;
+
+        Iterator() = default;
+        Iterator(Owner* owner, size_t bucket, size_t slot) : m_owner(owner), m_bucket(bucket), m_slot(slot) {}
+        // 非 const から const への変換
+        template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        Iterator(const Iterator<OtherConst>& other) : m_owner(other.m_owner), m_bucket(other.m_bucket), m_slot(other.m_slot) {}
+
+        reference operator*() const { return m_owner->m_buckets[m_bucket]->values[m_slot]; }
+        pointer operator->() const { return &**this; }
+
+        Iterator& operator++() {
+            const Bucket& bucket = *m_owner->m_buckets[m_bucket];
+            ++m_slot;
+            m_slot += bucket.skip[m_slot];
+            skip_exhausted_buckets();
+            return *this;
+        }
+        Iterator operator++(int) { Iterator old = *this; ++*this; return old; }
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.m_bucket == b.m_bucket && a.m_slot == b.m_slot; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return !(a == b); }
+
+    private:
+        friend class Iterator<!IsConst>;
+        friend class CColony;
+
+        // 現在のバケツを使い切っていたら、生存要素のある次のバケツへ進む（なければ end）
+        void skip_exhausted_buckets() {
+            const auto& buckets = m_owner->m_buckets;
+            while (m_bucket < buckets.size() && m_slot >= buckets[m_bucket]->high) {
+                if (++m_bucket == buckets.size()) {
+                    m_slot = 0;
+                    break;
+                }
+                m_slot = buckets[m_bucket]->skip[0];
+            }
+        }
+
+        Owner* m_owner = nullptr;  // 対象のコンテナ
+        size_t m_bucket = 0;       // バケツ番号（end ならバケツ数）
+        size_t m_slot = 0;         // バケツ内のスロット
+    };
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    /**
+     * @brief 要素を追加し、その要素を指すイテレータを返す（削除済みスロットを優先して再利用）
+     */
+    iterator insert(const T& value) {
+        while (!m_buckets_with_runs.empty() && m_buckets[m_buckets_with_runs.back()]->run_head == NoRun) {
+            m_buckets_with_runs.pop_back();
+        }
+        size_t index = 0;
+        Slot slot = 0;
+        if (!m_buckets_with_runs.empty()) {
+            index = m_buckets_with_runs.back();
+            Bucket& bucket = *m_buckets[index];
+            slot = bucket.run_head;
+            const Slot length = bucket.skip[slot];
+            if (length == 1) {
+                bucket.remove_run(slot);
+            } else {
+                // 区間の先頭を 1 つ後ろへずらす
+                bucket.skip[slot + 1] = bucket.skip[slot + length - 1] = static_cast<Slot>(length - 1);
+                bucket.move_run(slot, static_cast<Slot>(slot + 1));
+            }
+            bucket.skip[slot] = 0;
+        } else {
+            if (m_buckets.empty() || m_buckets.back()->high == BucketSize) {
+                m_buckets.push_back(std::make_unique<Bucket>());
+            }
+            index = m_buckets.size() - 1;
+            slot = static_cast<Slot>(m_buckets.back()->high++);
+        }
+        m_buckets[index]->values[slot] = value;
+        ++m_size;
+        return iterator(this, index, slot);
+    }
+
+    /**
+     * @brief pos の要素を削除する（ほかの要素のイテレータ・ポインタは有効なまま）
+     */
+    void erase(const_iterator pos) {
+        Bucket& bucket = *m_buckets[pos.m_bucket];
+        const auto slot = static_cast<Slot>(pos.m_slot);
+        const Slot left = slot > 0 ? bucket.skip[slot - 1] : Slot{0};  // 左隣の区間の長さ（左隣が区間の末尾）
+        const Slot right = bucket.skip[slot + 1];                        // 右隣の区間の長さ（右隣が区間の先頭）
+        if (bucket.run_head == NoRun) {
+            m_buckets_with_runs.push_back(pos.m_bucket);
+        }
+        if (left == 0 && right == 0) {
+            bucket.skip[slot] = 1;
+            bucket.add_run(slot);
+        } else if (right == 0) {
+            bucket.skip[slot - left] = bucket.skip[slot] = static_cast<Slot>(left + 1);
+        } else if (left == 0) {
+            bucket.skip[slot] = bucket.skip[slot + right] = static_cast<Slot>(right + 1);
+            bucket.move_run(static_cast<Slot>(slot + 1), slot);
+        } else {
+            bucket.skip[slot - left] = bucket.skip[slot + right] = static_cast<Slot>(left + right + 1);
+            bucket.remove_run(static_cast<Slot>(slot + 1));
+        }
+        --m_size;
+    }
+
+    void clear() {
+        m_buckets.clear();
+        m_buckets_with_runs.clear();
+        m_size = 0;
+    }
+
+    iterator begin() { return first(this); }
+    iterator end() { return iterator(this, m_buckets.size(), 0); }
+    const_iterator begin() const { return first(this); }
+    const_iterator end() const { return const_iterator(this, m_buckets.size(), 0); }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    size_t bucket_count() const { return m_buckets.size(); }
+
+private:
+    template<typename Owner>
+    static auto first(Owner* owner) {
+        Iterator<std::is_const_v<Owner>> it(owner, 0, owner->m_buckets.empty() ? 0 : owner->m_buckets[0]->skip[0]);
+        it.skip_exhausted_buckets();
+        return it;
+    }
+
+    std::vector<std::unique_ptr<Bucket>> m_buckets;  // バケツ（アドレスは固定）
+    std::vector<size_t> m_buckets_with_runs;         // 削除済み区間を持つ（可能性がある）バケツ番号
+    size_t m_size = 0;                               // 要素数
+};
+
+/**
+ * @brief ランダムな削除と再挿入を繰り返した後の走査を、CColony と標準コンテナで比較する
+ *
+ * 元データで満たしたコンテナに対し、要素の `ChurnFraction` をランダムに削除して同数を再挿入し、
+ * 続けて全要素を走査するサイクルを `ChurnCycles` 回繰り返します。削除対象は挿入順での位置として
+ * 全サイクル分を計測前に決めておき、4 方式で同じ要素を削除するので最終走査の合計が一致します。
+ * vector / deque は印の付いた要素を erase-remove で詰め、末尾へ再挿入します。list と colony は各要素の
+ * イテレータを挿入順に保持しておき、個別に削除してからイテレータ列を同じ印で詰めます
+ * （イテレータは安定なので保持したまま使えます）。
+ */
+template<typename Source>
+void run_colony_benchmark(const Source& src_array, std::uint64_t seed) {
+    using T = typename Source::value_type;
+    const auto churn = static_cast<size_t>(static_cast<double>(src_array.size()) * BenchmarkConfig::ChurnFraction);
+    std::cout << "\n● 削除・再挿入と走査（" << BenchmarkConfig::ChurnCycles << " サイクル x " << churn << " 要素）\n";
+    if (src_array.empty()) {
+        return;
+    }
+
+    // サイクルごとの削除対象（挿入順の位置に印）。要素数は各サイクルで元データの要素数に戻る
+    std::mt19937 random_engine(fold_seed(seed + 5));
+    std::vector<std::vector<char>> doomed_per_cycle(BenchmarkConfig::ChurnCycles, std::vector<char>(src_array.size(), 0));
+    for (auto& doomed : doomed_per_cycle) {
+        for (size_t removed = 0; removed < churn;) {
+            const size_t index = draw_uniform_int(random_engine, size_t{0}, doomed.size() - 1);
+            removed += doomed[index] == 0 ? 1 : 0;
+            doomed[index] = 1;
+        }
+    }
+    // 印の付いていない要素を前へ詰め、残った要素数を返す
+    auto compact = [](auto& sequence, const std::vector<char>& doomed) {
+        size_t write = 0;
+        for (size_t read = 0; read < doomed.size(); ++read) {
+            if (!doomed[read]) {
+                sequence[write++] = sequence[read];
+            }
+        }
+        return write;
+    };
+
+    // 削除・再挿入のサイクルを回し、削除+再挿入と走査の時間を別々に合計する
+    auto measure = [&](const std::string& name, auto& container, auto&& remove_doomed, auto&& reinsert) {
+        double churn_ms = 0.0;
+        double traverse_ms = 0.0;
+        std::int64_t total = 0;
+        size_t next = 0;
+        for (size_t cycle = 0; cycle < BenchmarkConfig::ChurnCycles; ++cycle) {
+            const auto churn_start = std::chrono::steady_clock::now();
+            remove_doomed(doomed_per_cycle[cycle]);
+            for (size_t i = 0; i < churn; ++i) {
+                reinsert(src_array.data()[next]);
+                next = next + 1 == src_array.size() ? 0 : next + 1;
+            }
+            churn_ms += elapsed_milliseconds(churn_start);
+            const auto traverse_start = std::chrono::steady_clock::now();
+            total = std::accumulate(container.begin(), container.end(), std::int64_t{0});
+            traverse_ms += elapsed_milliseconds(traverse_start);
+        }
+        std::cout << std::fixed << std::setprecision(2) << name << ": 削除+再挿入 " << churn_ms << " ms / 走査 " << traverse_ms
+                  << " ms (要素数 " << container.size() << ", 最終走査の合計 " << total << ")" << std::endl;
+    };
+
+    // vector / deque: 印の付いた要素を erase-remove で詰める
+    auto erase_remove = [&](auto& container) {
+        return [&](const std::vector<char>& doomed) {
+            const size_t kept = compact(container, doomed);
+            container.erase(container.begin() + static_cast<std::ptrdiff_t>(kept), container.end());
+        };
+    };
+    {
+        std::vector<T> vector(src_array.begin(), src_array.end());
+        measure("vector(erase-remove)", vector, erase_remove(vector), [&](T value) { vector.push_back(value); });
+    }
+    {
+        std::deque<T> deque(src_array.begin(), src_array.end());
+        measure("deque(erase-remove)", deque, erase_remove(deque), [&](T value) { deque.push_back(value); });
+    }
+
+    // list / colony: 挿入順に保持したイテレータで印の付いた要素を個別に削除し、イテレータ列を詰める
+    auto erase_by_handle = [&](auto& container, auto& handles) {
+        return [&](const std::vector<char>& doomed) {
+            for (size_t index = 0; index < doomed.size(); ++index) {
+                if (doomed[index]) {
+                    container.erase(handles[index]);
+                }
+            }
+            handles.resize(compact(handles, doomed));
+        };
+    };
+    {
+        std::list<T> list;
+        std::vector<typename std::list<T>::iterator> handles;
+        for (const auto& value : src_array) {
+            handles.push_back(list.insert(list.end(), value));
+        }
+        measure("list", list, erase_by_handle(list, handles), [&](T value) { handles.push_back(list.insert(list.end(), value)); });
+    }
+    {
+        CColony<T> colony;
+        std::vector<typename CColony<T>::iterator> handles;
+        for (const auto& value : src_array) {
+            handles.push_back(colony.insert(value));
+        }
+        measure("colony", colony, erase_by_handle(colony, handles), [&](T value) { handles.push_back(colony.insert(value)); });
+    }
+}
+
+// ===== 連想コンテナ =====
+/**
+ * @brief 64bit 値を攪拌する全単射（SplitMix64 の最終段）
+ *
+ * 異なる入力は必ず異なる出力になるため、一意なキーの生成とハッシュの両方に使えます。
+ */
+inline std::uint64_t mix64(std::uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/**
+ * @brief Robin Hood 方式のオープンアドレス法ハッシュテーブル
+ *
+ * スロットは 2 のべき乗個の連続領域で、線形探索の各位置に「本来の位置からの距離 + 1」（0 は空）を
+ * 別配列に持ちます。挿入時は距離の短い要素から場所を奪うため探索長のばらつきが小さく、検索は
+ * 自分より距離の短い要素に出会った時点でミスと判定できます。削除は後続の要素を 1 つずつ前へ詰める
+ * （backward shift）ので墓標を残しません。負荷率が `RobinHoodMaxLoad` を超えると容量を倍にします。
+ */
+template<typename Key, typename Value>
+class CRobinHoodMap final {
+public:
+    using value_type = std::pair<Key, Value>;
+
+    /**
+     * @brief 占有スロットだけを辿る前方イテレータ
+     */
+    class ConstIterator final {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<Key, Value>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        ConstIterator(const CRobinHoodMap* owner, size_t index) : m_owner(owner), m_index(index) { skip_empty(); }
+
+        reference operator*() const { return m_owner->m_slots[m_index]; }
+        pointer operator->() const { return &m_owner->m_slots[m_index]; }
+        ConstIterator& operator++() {
+            ++m_index;
+            skip_empty();
+            return *this;
+        }
+        friend bool operator==(const ConstIterator& a, const ConstIterator& b) { return a.m_index == b.m_index; }
+        friend bool operator!=(const ConstIterator& a, const ConstIterator& b) { return a.m_index != b.m_index; }
+
+    private:
+        void skip_empty() {
+            while (m_index < m_owner->m_distances.size() && m_owner->m_distances[m_index] == 0) {
+                ++m_index;
+            }
+        }
+
+        const CRobinHoodMap* m_owner;  // 対象のテーブル
+        size_t m_index;                // スロット位置
+    };
+
+    explicit CRobinHoodMap(size_t capacity = 16) { rehash(capacity); }
+
+    /**
+     * @brief キーを登録する（既存なら値を上書き）
+     */
+    void insert_or_assign(const Key& key, const Value& value) {
+        if (static_cast<double>(m_size + 1) > static_cast<double>(m_slots.size()) * BenchmarkConfig::RobinHoodMaxLoad) {
+            rehash(m_slots.size() * 2);
+        }
+        if (Value* existing = find(key)) {
+            *existing = value;
+            return;
+        }
+        place(value_type(key, value));
+        ++m_size;
+    }
+
+    /**
+     * @brief キーの値へのポインタを返す（なければ nullptr）
+     */
+    Value* find(const Key& key) {
+        return const_cast<Value*>(static_cast<const CRobinHoodMap&>(*this).find(key));
+    }
+    const Value* find(const Key& key) const {
+        size_t index = home(key);
+        for (std::uint32_t distance = 1;; ++distance, index = (index + 1) & m_mask) {
+            if (m_distances[index] < distance) {
+                return nullptr;  // 空き、または自分より本来の位置に近い要素 → 存在しない
+            }
+            if (m_slots[index].first == key) {
+                return &m_slots[index].second;
+            }
+        }
+    }
+
+    /**
+     * @brief キーを削除する（削除したら true）
+     */
+    bool erase(const Key& key) {
+        size_t index = home(key);
+        for (std::uint32_t distance = 1;; ++distance, index = (index + 1) & m_mask) {
+            if (m_distances[index] < distance) {
+                return false;
+            }
+            if (m_slots[index].first == key) {
+                break;
+            }
+        }
+        // 後続の要素を本来の位置に着くまで 1 つずつ前へ詰める
+        size_t next = (index + 1) & m_mask;
+        while (m_distances[next] > 1) {
+            m_slots[index] = std::move(m_slots[next]);
+            m_distances[index] = m_distances[next] - 1;
+            index = next;
+            next = (next + 1) & m_mask;
+        }
+        m_distances[index] = 0;
+        --m_size;
+        return true;
+    }
+
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, m_slots.size()); }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    size_t capacity() const { return m_slots.size(); }
+
+private:
+    size_t home(const Key& key) const { return static_cast<size_t>(mix64(static_cast<std::uint64_t>(key))) & m_mask; }
+
+    /**
+     * @brief 存在しないキーの要素を置く（距離の短い要素と入れ替えながら進む）
+     */
+    void place(value_type entry) {
+        size_t index = home(entry.first);
+        for (std::uint32_t distance = 1;; ++distance, index = (index + 1) & m_mask) {
+            if (m_distances[index] == 0) {
+                m_slots[index] = std::move(entry);
+                m_distances[index] = distance;
+                return;
+            }
+            if (m_distances[index] < distance) {
+                std::swap(m_slots[index], entry);
+                std::swap(m_distances[index], distance);
+            }
+        }
+    }
+
+    void rehash(size_t capacity) {
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        std::vector<value_type> slots(rounded);
+        std::vector<std::uint32_t> distances(rounded, 0);
+        slots.swap(m_slots);
+        distances.swap(m_distances);
+        m_mask = rounded - 1;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            if (distances[i] != 0) {
+                place(std::move(slots[i]));
+            }
+        }
+    }
+
+    std::vector<value_type> m_slots;         // キーと値
+    std::vector<std::uint32_t> m_distances;  // 本来の位置からの距離 + 1（0 は空き）
+    size_t m_mask = 0;                       // 容量 - 1
+    size_t m_size = 0;                       // 要素数
+};
+
+/**
+ * @brief キーで整列した std::vector によるフラットな連想配列
+ *
+ * 検索は二分探索、走査は連続領域の順次読み取りです。1 件ずつの挿入・削除は O(N) の移動を伴うため、
+ * 一括登録（`assign`: 追加してから整列）と一括削除（`erase_keys`: 印を付けて詰める）を用意しています。
+ */
+template<typename Key, typename Value>
+class CFlatMap final {
+public:
+    using value_type = std::pair<Key, Value>;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    /**
+     * @brief 未整列の組をまとめて登録する（同じキーは後のものを残す）
+     */
+    void assign(std::vector<value_type> entries) {
+        std::stable_sort(entries.begin(), entries.end(), [](const value_type& a, const value_type& b) { return a.first < b.first; });
+        m_entries.clear();
+        for (auto& entry : entries) {
+            if (!m_entries.empty() && m_entries.back().first == entry.first) {
+                m_entries.back() = std::move(entry);
+            } else {
+                m_entries.push_back(std::move(entry));
+            }
+        }
+    }
+
+    /**
+     * @brief キーを 1 件登録する（既存なら値を上書き。O(N)）
+     */
+    void insert_or_assign(const Key& key, const Value& value) {
+        const auto it = lower_bound(key);
+        if (it != m_entries.end() && it->first == key) {
+            it->second = value;
+        } else {
+            m_entries.insert(it, value_type(key, value));
+        }
+    }
+
+    const Value* find(const Key& key) const {
+        const auto it = lower_bound(key);
+        return it != m_entries.end() && it->first == key ? &it->second : nullptr;
+    }
+
+    /**
+     * @brief 指定したキーをまとめて削除する（削除した件数を返す）
+     */
+    size_t erase_keys(const std::vector<Key>& keys) {
+        std::vector<char> doomed(m_entries.size(), 0);
+        for (const Key& key : keys) {
+            const auto it = lower_bound(key);
+            if (it != m_entries.end() && it->first == key) {
+                doomed[static_cast<size_t>(it - m_entries.begin())] = 1;
+            }
+        }
+        size_t write = 0;
+        for (size_t read = 0; read < m_entries.size(); ++read) {
+            if (!doomed[read]) {
+                m_entries[write++] = std::move(m_entries[read]);
+            }
+        }
+        const size_t erased = m_entries.size() - write;
+        m_entries.resize(write);
+        return erased;
+    }
+
+    const_iterator begin() const { return m_entries.begin(); }
+    const_iterator end() const { return m_entries.end(); }
+    size_t size() const { return m_entries.size(); }
+    bool empty() const { return m_entries.empty(); }
+
+private:
+    typename std::vector<value_type>::iterator lower_bound(const Key& key) {
+        return std::lower_bound(m_entries.begin(), m_entries.end(), key, [](const value_type& entry, const Key& k) { return entry.first < k; });
+    }
+    const_iterator lower_bound(const Key& key) const {
+        return std::lower_bound(m_entries.begin(), m_entries.end(), key, [](const value_type& entry, const Key& k) { return entry.first < k; });
+    }
+
+    std::vector<value_type> m_entries;  // キーで整列した組
+};
+
+/**
+ * @brief 元データから作ったキーで、各連想コンテナの登録・検索・走査・削除を比較する
+ *
+ * キーは元データの先頭 `AssociativeKeys` 要素について `mix64(位置 << 32 | 値の下位 32bit)` とし、値は元データの値です
+ * （上位 32bit の位置が要素ごとに異なり mix64 は全単射なので、値の範囲によらずキーは一意で、
+ * 要素数以上の位置から作ったキーは必ずミスになります）。
+ * 検索は `AssociativeLookups` 回でヒットとミスが半々、削除は登録順で 1 つおきのキーです。
+ * CFlatMap の登録と削除は一括版（整列 / 印を付けて詰める）を使います。
+ */
+template<typename Source>
+void run_associative_benchmark(const Source& src_array, std::uint64_t seed) {
+    using T = typename Source::value_type;
+    using Key = std::uint64_t;
+    const size_t count = std::min(BenchmarkConfig::AssociativeKeys, src_array.size());
+    std::cout << "\n● 連想コンテナ（キー " << count << " 件, 検索 " << BenchmarkConfig::AssociativeLookups << " 回）\n";
+    if (count == 0) {
+        return;
+    }
+    static_assert(BenchmarkConfig::AssociativeKeys * 2 <= (std::uint64_t{1} << 32), "位置はキーの上位 32bit に収まる必要があります");
+    auto make_key = [](size_t position, T value) {
+        return mix64(static_cast<std::uint64_t>(position) << 32 | static_cast<std::uint32_t>(value));
+    };
+    std::vector<std::pair<Key, T>> entries(count);
+    for (size_t i = 0; i < count; ++i) {
+        entries[i] = {make_key(i, src_array.data()[i]), src_array.data()[i]};
+    }
+    std::mt19937 random_engine(fold_seed(seed + 6));
+    std::vector<Key> lookups(BenchmarkConfig::AssociativeLookups);
+    for (size_t i = 0; i < lookups.size(); ++i) {
+        const size_t position = draw_uniform_int(random_engine, size_t{0}, count - 1);
+        lookups[i] = i % 2 == 0 ? entries[position].first : make_key(count + position, T{});
+    }
+    std::vector<Key> erase_keys;
+    for (size_t i = 0; i < count; i += 2) {
+        erase_keys.push_back(entries[i].first);
+    }
+
+    // 各フェーズを計測し、検索のヒット数と値の合計、走査の合計、削除後の要素数を表示する
+    auto measure = [&](const std::string& name, auto& map, auto&& insert_all, auto&& find, auto&& erase_all) {
+        {
+            CScopeProfiler profiler(name + "_登録");
+            insert_all();
+        }
+        size_t hits = 0;
+        std::int64_t found_total = 0;
+        {
+            CScopeProfiler profiler(name + "_検索");
+            for (const Key key : lookups) {
+                if (const T* value = find(key)) {
+                    ++hits;
+                    found_total += *value;
+                }
+            }
+        }
+        std::int64_t iterated_total = 0;
+        {
+            CScopeProfiler profiler(name + "_走査");
+            for (const auto& entry : map) {
+                iterated_total += entry.second;
+            }
+        }
+        {
+            CScopeProfiler profiler(name + "_削除");
+            erase_all();
+        }
+        std::cout << name << ": ヒット " << hits << " 件 (値の合計 " << found_total << "), 走査の合計 " << iterated_total
+                  << ", 削除後 " << map.size() << " 件" << std::endl;
+    };
+    // std::map / std::unordered_map / CRobinHoodMap は 1 件ずつ登録・削除する
+    auto measure_each = [&](const std::string& name, auto& map, auto&& find) {
+        measure(
+            name, map,
+            [&]() {
+                for (const auto& [key, value] : entries) {
+                    map.insert_or_assign(key, value);
+                }
+            },
+            find,
+            [&]() {
+                for (const Key key : erase_keys) {
+                    map.erase(key);
+                }
+            });
+    };
+    {
+        std::map<Key, T> map;
+        measure_each("map", map, [&](Key key) -> const T* {
+            const auto it = map.find(key);
+            return it != map.end() ? &it->second : nullptr;
+        });
+    }
+    {
+        std::unordered_map<Key, T> map;
+        measure_each("unordered_map", map, [&](Key key) -> const T* {
+            const auto it = map.find(key);
+            return it != map.end() ? &it->second : nullptr;
+        });
+    }
+    {
+        CRobinHoodMap<Key, T> map;
+        measure_each("robin_hood", map, [&](Key key) { return map.find(key); });
+    }
+    {
+        CFlatMap<Key, T> map;
+        measure(
+            "flat_map", map, [&]() { map.assign(entries); }, [&](Key key) { return map.find(key); },
+            [&]() { map.erase_keys(erase_keys); });
+    }
+}
+
+// ===== B+木 =====
+/**
+ * @brief ノードサイズをバイト数で指定する B+木（キー → 値、キーは一意）
+ *
+ * 葉はキー配列と値配列を分けて持ち、次の葉へのポインタで連結します（範囲走査は葉を順に辿るだけ）。
+ * 内部ノードは区切りキーと子へのポインタだけを持ち、1 ノードが `NodeBytes` に収まる最大の分岐数を使います。
+ * 探索はノード内の二分探索で、ノード 1 つあたりのキャッシュミスは数本のキャッシュラインに収まります。
+ * `bulk_load` は整列済みの列から葉を詰めて下から組み立て、`insert` は満杯のノードを半分に分割します。
+ */
+template<typename Key, typename Value, size_t NodeBytes = BenchmarkConfig::BTreeNodeBytes>
+class CBPlusTree final {
+    struct Node {
+        size_t count = 0;  // 使用中のキー数
+    };
+    static constexpr size_t NodePayload = NodeBytes > sizeof(Node) + sizeof(void*) ? NodeBytes - sizeof(Node) - sizeof(void*) : 0;
+    static constexpr size_t LeafCapacity = std::max<size_t>(4, NodePayload / (sizeof(Key) + sizeof(Value)));
+    static constexpr size_t InnerCapacity = std::max<size_t>(4, NodePayload / (sizeof(Key) + sizeof(void*)));
+
+    struct Leaf : Node {
+        std::array<Key, LeafCapacity> keys;      // 整列済みのキー
+        std::array<Value, LeafCapacity> values;  // キーに対応する値
+        Leaf* next = nullptr;                    // 次の葉
+    };
+    struct Inner : Node {
+        std::array<Key, InnerCapacity> keys;              // keys[i] は children[i + 1] 以下の最小キー
+        std::array<Node*, InnerCapacity + 1> children{};  // 子ノード
+    };
+
+    // 子の分割結果（right が nullptr なら分割なし）
+    struct Split {
+        Node* right = nullptr;  // 新しくできた右側のノード
+        Key separator{};        // right 以下の最小キー
+    };
+
+public:
+    /**
+     * @brief 葉の要素を辿る前方イテレータ（key() / value() で参照）
+     */
+    class ConstIterator final {
+    public:
+        ConstIterator(const Leaf* leaf, size_t index) : m_leaf(leaf), m_index(index) { normalize(); }
+
+        const Key& key() const { return m_leaf->keys[m_index]; }
+        const Value& value() const { return m_leaf->values[m_index]; }
+        ConstIterator& operator++() {
+            ++m_index;
+            normalize();
+            return *this;
+        }
+        friend bool operator==(const ConstIterator& a, const ConstIterator& b) { return a.m_leaf == b.m_leaf && a.m_index == b.m_index; }
+        friend bool operator!=(const ConstIterator& a, const ConstIterator& b) { return !(a == b); }
+
+    private:
+        // 葉の末尾に達したら次の葉の先頭へ進む（最後なら end）
+        void normalize() {
+            while (m_leaf != nullptr && m_index == m_leaf->count) {
+                m_leaf = m_leaf->next;
+                m_index = 0;
+            }
+        }
+
+        const Leaf* m_leaf;  // 現在の葉（end なら nullptr）
+        size_t m_index;      // 葉内の位置
+    };
+
+    CBPlusTree() = default;
+    ~CBPlusTree() { clear(); }
+
+    CBPlusTree(const CBPlusTree&) = delete;
+    CBPlusTree& operator=(const CBPlusTree&) = delete;
+
+    /**
+     * @brief キー昇順・重複なしの範囲 [first, last)（要素は std::pair<Key, Value>）から木を組み立てる
+     */
+    template<typename Iterator>
+    void bulk_load(Iterator first, Iterator last) {
+        clear();
+        std::vector<std::pair<Key, Node*>> level;  // 各ノードの最小キーとノード
+        Leaf* previous = nullptr;
+        while (first != last) {
+            Leaf* leaf = new Leaf();
+            for (; first != last && leaf->count < LeafCapacity; ++first, ++leaf->count) {
+                leaf->keys[leaf->count] = first->first;
+                leaf->values[leaf->count] = first->second;
+            }
+            (previous != nullptr ? previous->next : m_first_leaf) = leaf;
+            previous = leaf;
+            m_size += leaf->count;
+            level.emplace_back(leaf->keys[0], leaf);
+        }
+        if (level.empty()) {
+            return;
+        }
+        // 下の段を InnerCapacity + 1 個ずつまとめて親を作る
+        while (level.size() > 1) {
+            std::vector<std::pair<Key, Node*>> parents;
+            for (size_t i = 0; i < level.size(); i += InnerCapacity + 1) {
+                Inner* inner = new Inner();
+                const size_t end = std::min(level.size(), i + InnerCapacity + 1);
+                inner->children[0] = level[i].second;
+                for (size_t j = i + 1; j < end; ++j) {
+                    inner->keys[inner->count] = level[j].first;
+                    inner->children[++inner->count] = level[j].second;
+                }
+                parents.emplace_back(level[i].first, inner);
+            }
+            level.swap(parents);
+            ++m_height;
+        }
+        m_root = level.front().second;
+    }
+
+    /**
+     * @brief キーを登録する（既存なら値を上書き）
+     */
+    void insert_or_assign(const Key& key, const Value& value) {
+        if (m_root == nullptr) {
+            Leaf* leaf = new Leaf();
+            m_root = m_first_leaf = leaf;
+            m_height = 0;
+        }
+        const Split split = insert_into(m_root, m_height, key, value);
+        if (split.right != nullptr) {
+            Inner* root = new Inner();
+            root->count = 1;
+            root->keys[0] = split.separator;
+            root->children[0] = m_root;
+            root->children[1] = split.right;
+            m_root = root;
+            ++m_height;
+        }
+    }
+
+    const Value* find(const Key& key) const {
+        const Leaf* leaf = find_leaf(key);
+        if (leaf == nullptr) {
+            return nullptr;
+        }
+        const auto it = std::lower_bound(leaf->keys.begin(), leaf->keys.begin() + static_cast<std::ptrdiff_t>(leaf->count), key);
+        return it != leaf->keys.begin() + static_cast<std::ptrdiff_t>(leaf->count) && *it == key ? &leaf->values[static_cast<size_t>(it - leaf->keys.begin())]
+                                                                                                 : nullptr;
+    }
+
+    /**
+     * @brief key 以上の最初の要素を指すイテレータを返す
+     */
+    ConstIterator lower_bound(const Key& key) const {
+        const Leaf* leaf = find_leaf(key);
+        if (leaf == nullptr) {
+            return end();
+        }
+        const auto it = std::lower_bound(leaf->keys.begin(), leaf->keys.begin() + static_cast<std::ptrdiff_t>(leaf->count), key);
+        return ConstIterator(leaf, static_cast<size_t>(it - leaf->keys.begin()));
+    }
+
+    void clear() {
+        if (m_root != nullptr) {
+            destroy(m_root, m_height);
+        }
+        m_root = nullptr;
+        m_first_leaf = nullptr;
+        m_height = 0;
+        m_size = 0;
+    }
+
+    ConstIterator begin() const { return ConstIterator(m_first_leaf, 0); }
+    ConstIterator end() const { return ConstIterator(nullptr, 0); }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    size_t height() const { return m_height; }
+    static constexpr size_t leaf_capacity() { return LeafCapacity; }
+    static constexpr size_t inner_capacity() { return InnerCapacity; }
+
+private:
+    const Leaf* find_leaf(const Key& key) const {
+        const Node* node = m_root;
+        if (node == nullptr) {
+            return nullptr;
+        }
+        for (size_t level = m_height; level > 0; --level) {
+            const Inner* inner = static_cast<const Inner*>(node);
+            const auto it = std::upper_bound(inner->keys.begin(), inner->keys.begin() + static_cast<std::ptrdiff_t>(inner->count), key);
+            node = inner->children[static_cast<size_t>(it - inner->keys.begin())];
+        }
+        return static_cast<const Leaf*>(node);
+    }
+
+    Split insert_into(Node* node, size_t level, const Key& key, const Value& value) {
+        if (level == 0) {
+            Leaf* leaf = static_cast<Leaf*>(node);
+            const auto position = static_cast<size_t>(
+                std::lower_bound(leaf->keys.begin(), leaf->keys.begin() + static_cast<std::ptrdiff_t>(leaf->count), key) - leaf->keys.begin());
+            if (position < leaf->count && leaf->keys[position] == key) {
+                leaf->values[position] = value;
+                return {};
+            }
+            ++m_size;
+            Split split;
+            if (leaf->count == LeafCapacity) {
+                // 後半を新しい葉へ移してから、挿入位置に応じた側へ入れる
+                Leaf* right = new Leaf();
+                const size_t half = LeafCapacity / 2;
+                right->count = LeafCapacity - half;
+                std::copy(leaf->keys.begin() + half, leaf->keys.end(), right->keys.begin());
+                std::copy(leaf->values.begin() + half, leaf->values.end(), right->values.begin());
+                leaf->count = half;
+                right->next = leaf->next;
+                leaf->next = right;
+                split.right = right;
+                if (position > half) {
+                    insert_into_leaf(right, position - half, key, value);
+                } else {
+                    insert_into_leaf(leaf, position, key, value);
+                }
+                split.separator = right->keys[0];
+                return split;
+            }
+            insert_into_leaf(leaf, position, key, value);
+            return split;
+        }
+
+        Inner* inner = static_cast<Inner*>(node);
+        const auto index = static_cast<size_t>(
+            std::upper_bound(inner->keys.begin(), inner->keys.begin() + static_cast<std::ptrdiff_t>(inner->count), key) - inner->keys.begin());
+        const Split child = insert_into(inner->children[index], level - 1, key, value);
+        if (child.right == nullptr) {
+            return {};
+        }
+        if (inner->count < InnerCapacity) {
+            insert_into_inner(inner, index, child);
+            return {};
+        }
+        // 満杯の内部ノード: いったん 1 つ多い作業領域に並べ、中央のキーを親へ上げて分割する
+        std::array<Key, InnerCapacity + 1> keys;
+        std::array<Node*, InnerCapacity + 2> children;
+        std::copy(inner->keys.begin(), inner->keys.begin() + static_cast<std::ptrdiff_t>(index), keys.begin());
+        keys[index] = child.separator;
+        std::copy(inner->keys.begin() + static_cast<std::ptrdiff_t>(index), inner->keys.end(), keys.begin() + static_cast<std::ptrdiff_t>(index + 1));
+        std::copy(inner->children.begin(), inner->children.begin() + static_cast<std::ptrdiff_t>(index + 1), children.begin());
+        children[index + 1] = child.right;
+        std::copy(inner->children.begin() + static_cast<std::ptrdiff_t>(index + 1), inner->children.end(),
+                  children.begin() + static_cast<std::ptrdiff_t>(index + 2));
+        const size_t middle = (InnerCapacity + 1) / 2;
+        Inner* right = new Inner();
+        inner->count = middle;
+        std::copy(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(middle), inner->keys.begin());
+        std::copy(children.begin(), children.begin() + static_cast<std::ptrdiff_t>(middle + 1), inner->children.begin());
+        right->count = InnerCapacity - middle;
+        std::copy(keys.begin() + static_cast<std::ptrdiff_t>(middle + 1), keys.end(), right->keys.begin());
+        std::copy(children.begin() + static_cast<std::ptrdiff_t>(middle + 1), children.end(), right->children.begin());
+        return {right, keys[middle]};
+    }
+
+    static void insert_into_leaf(Leaf* leaf, size_t position, const Key& key, const Value& value) {
+        std::copy_backward(leaf->keys.begin() + static_cast<std::ptrdiff_t>(position), leaf->keys.begin() + static_cast<std::ptrdiff_t>(leaf->count),
+                           leaf->keys.begin() + static_cast<std::ptrdiff_t>(leaf->count + 1));
+        std::copy_backward(leaf->values.begin() + static_cast<std::ptrdiff_t>(position),
+                           leaf->values.begin() + static_cast<std::ptrdiff_t>(leaf->count),
+                           leaf->values.begin() + static_cast<std::ptrdiff_t>(leaf->count + 1));
+        leaf->keys[position] = key;
+        leaf->values[position] = value;
+        ++leaf->count;
+    }
+
+    static void insert_into_inner(Inner* inner, size_t index, const Split& child) {
+        std::copy_backward(inner->keys.begin() + static_cast<std::ptrdiff_t>(index), inner->keys.begin() + static_cast<std::ptrdiff_t>(inner->count),
+                           inner->keys.begin() + static_cast<std::ptrdiff_t>(inner->count + 1));
+        std::copy_backward(inner->children.begin() + static_cast<std::ptrdiff_t>(index + 1),
+                           inner->children.begin() + static_cast<std::ptrdiff_t>(inner->count + 1),
+                           inner->children.begin() + static_cast<std::ptrdiff_t>(inner->count + 2));
+        inner->keys[index] = child.separator;
+        inner->children[index + 1] = child.right;
+        ++inner->count;
+    }
+
+    static void destroy(Node* node, size_t level) {
+        if (level == 0) {
+            delete static_cast<Leaf*>(node);
+            return;
+        }
+        Inner* inner = static_cast<Inner*>(node);
+        for (size_t i = 0; i <= inner->count; ++i) {
+            destroy(inner->children[i], level - 1);
+        }
+        delete inner;
+    }
+
+    Node* m_root = nullptr;        // 根
+    Leaf* m_first_leaf = nullptr;  // 最左の葉（走査の起点）
+    size_t m_height = 0;           // 根から葉までの段数（葉だけなら 0）
+    size_t m_size = 0;             // 要素数
+};
+
+/**
+ * @brief 時系列インデックスを想定し、B+木・std::map・整列済み vector を比較する
+ *
+ * 元データの i 番目の値をキー 2i（時刻）に対応させ、整列済みの列からの一括構築、点検索
+ * （`OrderedLookups` 回、奇数キーはミス）、`RangeScanWidth` 要素の範囲走査と平均・分散
+ * （`RangeScans` 回）、奇数キーのランダム挿入（`OrderedInserts` 件）を計測します。
+ * 整列済み vector の挿入は 1 件ずつだと O(N) の移動が支配するため、末尾に追加して整列し
+ * inplace_merge する一括版です。B+木はノード 256 B（キャッシュライン 4 本）と 4 KB（ページ）の 2 種類です。
+ */
+template<typename Source>
+void run_ordered_benchmark(const Source& src_array, std::uint64_t seed) {
+    using T = typename Source::value_type;
+    using Key = std::uint64_t;
+    using Entry = std::pair<Key, T>;
+    std::cout << "\n● 順序付きコンテナ（" << src_array.size() << " 要素, 範囲走査 " << BenchmarkConfig::RangeScans << " 回 x "
+              << BenchmarkConfig::RangeScanWidth << " 要素）\n";
+    if (src_array.empty()) {
+        return;
+    }
+    const size_t n = src_array.size();
+    std::vector<Entry> entries(n);
+    for (size_t i = 0; i < n; ++i) {
+        entries[i] = {2 * static_cast<Key>(i), src_array.data()[i]};
+    }
+    std::mt19937 random_engine(fold_seed(seed + 7));
+    std::vector<Key> lookups(BenchmarkConfig::OrderedLookups);
+    std::generate(lookups.begin(), lookups.end(), [&]() { return draw_uniform_int(random_engine, Key{0}, 2 * static_cast<Key>(n) - 1); });
+    const size_t width = std::min(BenchmarkConfig::RangeScanWidth, n);
+    std::vector<Key> range_starts(BenchmarkConfig::RangeScans);
+    std::generate(range_starts.begin(), range_starts.end(),
+                  [&]() { return 2 * static_cast<Key>(draw_uniform_int(random_engine, size_t{0}, n - width)); });
+    std::vector<Entry> inserts(BenchmarkConfig::OrderedInserts);
+    std::generate(inserts.begin(), inserts.end(), [&]() {
+        const size_t position = draw_uniform_int(random_engine, size_t{0}, n - 1);
+        return Entry{2 * static_cast<Key>(position) + 1, src_array.data()[position]};
+    });
+
+    // 各フェーズを計測して結果を表示する。range は [from, from + 2 * width) のキーの値を Welford 状態へ畳み込む
+    auto measure = [&](const std::string& name, auto&& bulk_load, auto&& find, auto&& range, auto&& insert_all, auto&& size) {
+        {
+            CScopeProfiler profiler(name + "_一括構築");
+            bulk_load();
+        }
+        std::int64_t found_total = 0;
+        {
+            CScopeProfiler profiler(name + "_点検索");
+            for (const Key key : lookups) {
+                if (const T* value = find(key)) {
+                    found_total += *value;
+                }
+            }
+        }
+        WelfordState total;
+        {
+            CScopeProfiler profiler(name + "_範囲走査");
+            for (const Key from : range_starts) {
+                total.merge(range(from, from + 2 * width));
+            }
+        }
+        {
+            CScopeProfiler profiler(name + "_ランダム挿入");
+            insert_all();
+        }
+        std::cout << std::fixed << std::setprecision(3) << name << ": 点検索の値の合計 " << found_total << ", 範囲の平均値/分散 "
+                  << total.mean << " / " << total.variance() << ", 挿入後 " << size() << " 件" << std::endl;
+    };
+    {
+        std::map<Key, T> map;
+        measure(
+            "map", [&]() { map = std::map<Key, T>(entries.begin(), entries.end()); },
+            [&](Key key) -> const T* {
+                const auto it = map.find(key);
+                return it != map.end() ? &it->second : nullptr;
+            },
+            [&](Key from, Key to) {
+                WelfordState state;
+                for (auto it = map.lower_bound(from); it != map.end() && it->first < to; ++it) {
+                    state.add(static_cast<double>(it->second));
+                }
+                return state;
+            },
+            [&]() {
+                for (const auto& [key, value] : inserts) {
+                    map.insert_or_assign(key, value);
+                }
+            },
+            [&]() { return map.size(); });
+    }
+    {
+        std::vector<Entry> vector;
+        auto by_key = [](const Entry& entry, Key key) { return entry.first < key; };
+        measure(
+            "sorted_vector", [&]() { vector.assign(entries.begin(), entries.end()); },
+            [&](Key key) -> const T* {
+                const auto it = std::lower_bound(vector.begin(), vector.end(), key, by_key);
+                return it != vector.end() && it->first == key ? &it->second : nullptr;
+            },
+            [&](Key from, Key to) {
+                WelfordState state;
+                for (auto it = std::lower_bound(vector.begin(), vector.end(), from, by_key); it != vector.end() && it->first < to; ++it) {
+                    state.add(static_cast<double>(it->second));
+                }
+                return state;
+            },
+            [&]() {
+                // 挿入分を整列して重複キーは後のものを残し、既存の列と併合する
+                std::vector<Entry> batch(inserts.begin(), inserts.end());
+                std::stable_sort(batch.begin(), batch.end(), [](const Entry& a, const Entry& b) { return a.first < b.first; });
+                const auto middle = static_cast<std::ptrdiff_t>(vector.size());
+                for (const auto& entry : batch) {
+                    if (static_cast<std::ptrdiff_t>(vector.size()) > middle && vector.back().first == entry.first) {
+                        vector.back() = entry;
+                    } else {
+                        vector.push_back(entry);
+                    }
+                }
+                std::inplace_merge(vector.begin(), vector.begin() + middle, vector.end(),
+                                   [](const Entry& a, const Entry& b) { return a.first < b.first; });
+            },
+            [&]() { return vector.size(); });
+    }
+    auto measure_tree = [&](auto& tree, const std::string& name) {
+        measure(
+            name, [&]() { tree.bulk_load(entries.begin(), entries.end()); }, [&](Key key) { return tree.find(key); },
+            [&](Key from, Key to) {
+                WelfordState state;
+                for (auto it = tree.lower_bound(from); it != tree.end() && it.key() < to; ++it) {
+                    state.add(static_cast<double>(it.value()));
+                }
+                return state;
+            },
+            [&]() {
+                for (const auto& [key, value] : inserts) {
+                    tree.insert_or_assign(key, value);
+                }
+            },
+            [&]() { return tree.size(); });
+    };
+    {
+        CBPlusTree<Key, T> tree;
+        measure_tree(tree, "bplus_tree(" + std::to_string(BenchmarkConfig::BTreeNodeBytes) + "B)");
+    }
+    {
+        CBPlusTree<Key, T, 4096> tree;
+        measure_tree(tree, "bplus_tree(4096B)");
+    }
+}
+
+// ===== 優先度キュー =====
+/**
+ * @brief d 分木の最小ヒープ（std::vector 上の暗黙的な木）
+ *
+ * 分岐数を増やすと木が浅くなり push の比較回数が減ります。pop は子 d 個の最小値を探すので
+ * 比較は増えますが、子が連続領域に並ぶためキャッシュラインの利用効率は上がります。
+ */
+template<typename T, size_t Arity>
+class CDaryHeap final {
+    static_assert(Arity >= 2, "分岐数は 2 以上にしてください");
+
+public:
+    void push(const T& value) {
+        size_t index = m_values.size();
+        m_values.push_back(value);
+        while (index > 0) {
+            const size_t parent = (index - 1) / Arity;
+            if (!(value < m_values[parent])) {
+                break;
+            }
+            m_values[index] = m_values[parent];
+            index = parent;
+        }
+        m_values[index] = value;
+    }
+
+    const T& top() const { return m_values.front(); }
+
+    void pop() {
+        const T value = m_values.back();
+        m_values.pop_back();
+        if (m_values.empty()) {
+            return;
+        }
+        size_t index = 0;
+        const size_t size = m_values.size();
+        while (true) {
+            const size_t first_child = index * Arity + 1;
+            if (first_child >= size) {
+                break;
+            }
+            const size_t last_child = std::min(first_child + Arity, size);
+            size_t smallest = first_child;
+            for (size_t child = first_child + 1; child < last_child; ++child) {
+                if (m_values[child] < m_values[smallest]) {
+                    smallest = child;
+                }
+            }
+            if (!(m_values[smallest] < value)) {
+                break;
+            }
+            m_values[index] = m_values[smallest];
+            index = smallest;
+        }
+        m_values[index] = value;
+    }
+
+    size_t size() const { return m_values.size(); }
+    bool empty() const { return m_values.empty(); }
+
+private:
+    std::vector<T> m_values;  // ヒープ順に並んだ要素
+};
+
+/**
+ * @brief ペアリングヒープ（最小ヒープ）
+ *
+ * push は根との併合だけの O(1)、pop は根の子を 2 パスで併合する償却 O(log N) です。
+ * ノードは std::vector に確保して番号で参照し、解放したノードは空きリストで再利用します。
+ */
+template<typename T>
+class CPairingHeap final {
+    using Index = std::uint32_t;
+    static constexpr Index None = std::numeric_limits<Index>::max();
+
+    struct Node {
+        T value{};             // 値
+        Index child = None;    // 最初の子
+        Index sibling = None;  // 次の兄弟（空きリストでは次の空きノード）
+    };
+
+public:
+    void push(const T& value) {
+        Index node = m_free;
+        if (node != None) {
+            m_free = m_nodes[node].sibling;
+            m_nodes[node] = Node{value, None, None};
+        } else {
+            node = static_cast<Index>(m_nodes.size());
+            m_nodes.push_back(Node{value, None, None});
+        }
+        m_root = meld(m_root, node);
+        ++m_size;
+    }
+
+    const T& top() const { return m_nodes[m_root].value; }
+
+    void pop() {
+        const Index old_root = m_root;
+        // 1 パス目: 子を左から 2 つずつ併合し、結果を逆順に繋ぐ
+        Index pairs = None;
+        Index child = m_nodes[old_root].child;
+        while (child != None) {
+            const Index first = child;
+            const Index second = m_nodes[first].sibling;
+            child = second != None ? m_nodes[second].sibling : None;
+            m_nodes[first].sibling = None;
+            if (second != None) {
+                m_nodes[second].sibling = None;
+            }
+            const Index merged = meld(first, second);
+            m_nodes[merged].sibling = pairs;
+            pairs = merged;
+        }
+        // 2 パス目: 右から順に 1 本へ併合する
+        Index root = None;
+        while (pairs != None) {
+            const Index next = m_nodes[pairs].sibling;
+            m_nodes[pairs].sibling = None;
+            root = meld(root, pairs);
+            pairs = next;
+        }
+        m_root = root;
+        m_nodes[old_root].sibling = m_free;
+        m_free = old_root;
+        --m_size;
+    }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+private:
+    // 2 つの木を併合し、新しい根を返す（大きい方の根を小さい方の最初の子にする）
+    Index meld(Index a, Index b) {
+        if (a == None) {
+            return b;
+        }
+        if (b == None) {
+            return a;
+        }
+        if (m_nodes[b].value < m_nodes[a].value) {
+            std::swap(a, b);
+        }
+        m_nodes[b].sibling = m_nodes[a].child;
+        m_nodes[a].child = b;
+        return a;
+    }
+
+    std::vector<Node> m_nodes;  // ノードの格納領域
+    Index m_root = None;        // 根
+    Index m_free = None;        // 空きノードのリスト
+    size_t m_size = 0;          // 要素数
+};
+
+/**
+ * @brief 単調な整数キー用の基数ヒープ（最小ヒープ）
+ *
+ * 取り出すキーが単調非減少で、追加するキーが直前に取り出したキー以上であることが前提です
+ * （タイマーやイベントスケジューラの時刻がこれを満たします）。キーは直前に取り出した値との
+ * 排他的論理和の最上位ビットでバケツに分け、バケツ 0 が空になったときだけ最初の空でない
+ * バケツを再分配します。各キーは高々ビット数回しか移動しないため、比較ベースのヒープより軽量です。
+ */
+template<typename T>
+class CRadixHeap final {
+    static_assert(std::is_unsigned_v<T>, "CRadixHeap は符号なし整数キー専用です");
+    static constexpr size_t Buckets = std::numeric_limits<T>::digits + 1;
+
+public:
+    void push(const T& value) {
+        m_buckets[bucket_of(value)].push_back(value);
+        ++m_size;
+    }
+
+    /**
+     * @brief 最小のキーを返す（必要ならバケツを再分配するため const ではない）
+     */
+    const T& top() {
+        refill();
+        return m_buckets[0].back();
+    }
+
+    void pop() {
+        refill();
+        m_buckets[0].pop_back();
+        --m_size;
+    }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+private:
+    size_t bucket_of(T value) const {
+        const T diff = value ^ m_last;
+        size_t width = 0;
+        for (T rest = diff; rest != 0; rest >>= 1) {
+            ++width;
+        }
+        return width;
+    }
 
-// ===== ベンチマーク設定 =====
-// ベンチマーク全体で使用する設定値を構造体に集約
-struct BenchmarkConfig {
-    using DataType = int;  // テスト対象のデータ型
-    static constexpr size_t Size = 1000000;  // 配列の要素数
-    static constexpr size_t ReadingRepeat = 10;  // 読み取り回数
-    static constexpr size_t DisplayCount = 10;  // 表示する要素数
-    static constexpr DataType MinRandomValue = -100; // 生成する乱数の最小値
-    static constexpr DataType MaxRandomValue = 100;  // 生成する乱数の最大値
+    // バケツ 0 が空なら、最初の空でないバケツの最小値を基準に再分配する
+    void refill() {
+        if (!m_buckets[0].empty()) {
+            return;
+        }
+        size_t index = 1;
+        while (m_buckets[index].empty()) {
+            ++index;
+        }
+        m_last = *std::min_element(m_buckets[index].begin(), m_buckets[index].end());
+        for (const T value : m_buckets[index]) {
+            m_buckets[bucket_of(value)].push_back(value);
+        }
+        m_buckets[index].clear();
+    }
+
+    std::array<std::vector<T>, Buckets> m_buckets;  // 直前の最小値との差の桁数ごとのバケツ
+    T m_last = 0;                                    // 直前に取り出した（基準となる）キー
+    size_t m_size = 0;                               // 要素数
 };
 
-// ===== ヘルパー関数群 =====
 /**
- * @brief ベンチマークの元データとなる固定長配列に乱数を格納する
- * @tparam T 格納するデータの型
- * @tparam N 配列の要素数
- * @param src_array データを格納する配列（出力）
- * @param min_val 乱数の最小値
- * @param max_val 乱数の最大値
+ * @brief イベントスケジューラを想定した優先度キューの比較
+ *
+ * 元データの連続する 2 値から遅延時間 `(v1 - 最小値) x 値の幅 + (v2 - 最小値)` を作り、
+ * 時刻 0 から `PriorityQueueSize` 件を積む（構築）、最小を取り出して「取り出した時刻 + 遅延」を積む
+ * hold 操作を `PriorityQueueOperations` 回（混在）、最後に空になるまで取り出す（排出）の 3 段階を計測します。
+ * 最小値と値の幅はデータの実測値を使い、幅が大きすぎる場合は全操作を終えても時刻が Key で桁あふれしない
+ * 幅まで縮めます。これで積むキーは常に直前に取り出したキー以上となり、基数ヒープの前提を満たします。
+ * 取り出したキーの合計で全方式の結果が一致することを確認できます。
  */
-template<typename T, size_t N>
-void generate_source_data(std::array<T, N>& src_array, T min_val, T max_val) {
-    // ----- 乱数生成器の初期化 -----
-    std::random_device seed_gen;  // 真の乱数生成器（シード用）
-    std::mt19937 random_engine(seed_gen());  // メルセンヌツイスタ乱数エンジン
-    std::uniform_int_distribution<T> dist(min_val, max_val);  // 一様分布
-    // ----- 固定長配列に乱数値を格納 -----
-    {
-        CScopeProfiler profiler("配列生成_乱数");
-        // 配列の各要素に乱数を格納
-        std::generate(src_array.begin(), src_array.end(), [&]() { return dist(random_engine); });
+template<typename Source>
+void run_priority_queue_benchmark(const Source& src_array) {
+    using Key = std::uint64_t;
+    std::cout << "\n● 優先度キュー（" << BenchmarkConfig::PriorityQueueSize << " 件, hold 操作 " << BenchmarkConfig::PriorityQueueOperations
+              << " 回）\n";
+    if (src_array.empty()) {
+        return;
     }
+    const auto [min_it, max_it] = std::minmax_element(src_array.begin(), src_array.end());
+    const auto min_value = static_cast<std::int64_t>(*min_it);
+    const auto span = static_cast<Key>(static_cast<std::int64_t>(*max_it) - min_value + 1);
+    // 遅延の上限（構築と hold を全部積み重ねても Key に収まる）と、それを超えない 1 桁あたりの幅
+    const Key max_delay = std::numeric_limits<Key>::max() / (BenchmarkConfig::PriorityQueueSize + BenchmarkConfig::PriorityQueueOperations + 1);
+    auto radix = static_cast<Key>(std::sqrt(static_cast<double>(max_delay)));
+    while (radix * radix > max_delay) {
+        --radix;
+    }
+    radix = std::min(radix, span);
+    auto offset = [&](auto value) {
+        const auto shifted = static_cast<Key>(static_cast<std::int64_t>(value) - min_value);
+        return radix == span ? shifted : shifted * radix / span;
+    };
+
+    auto measure = [&](auto queue, const std::string& name) {
+        size_t next = 0;
+        auto next_delay = [&]() {
+            const Key high = offset(src_array.data()[next]);
+            next = next + 1 == src_array.size() ? 0 : next + 1;
+            const Key low = offset(src_array.data()[next]);
+            next = next + 1 == src_array.size() ? 0 : next + 1;
+            return high * radix + low;
+        };
+        Key popped_total = 0;
+        {
+            CScopeProfiler profiler(name + "_構築");
+            for (size_t i = 0; i < BenchmarkConfig::PriorityQueueSize; ++i) {
+                queue.push(next_delay());
+            }
+        }
+        {
+            CScopeProfiler profiler(name + "_混在");
+            for (size_t i = 0; i < BenchmarkConfig::PriorityQueueOperations && !queue.empty(); ++i) {
+                const Key now = queue.top();
+                queue.pop();
+                popped_total += now;
+                queue.push(now + next_delay());
+            }
+        }
+        {
+            CScopeProfiler profiler(name + "_排出");
+            while (!queue.empty()) {
+                popped_total += queue.top();
+                queue.pop();
+            }
+        }
+        std::cout << name << ": 取り出したキーの合計 " << popped_total << std::endl;
+    };
+    measure(std::priority_queue<Key, std::vector<Key>, std::greater<Key>>(), "priority_queue<vector>");
+    measure(std::priority_queue<Key, std::deque<Key>, std::greater<Key>>(), "priority_queue<deque>");
+    measure(CDaryHeap<Key, 4>(), "4分ヒープ");
+    measure(CDaryHeap<Key, 8>(), "8分ヒープ");
+    measure(CPairingHeap<Key>(), "ペアリングヒープ");
+    measure(CRadixHeap<Key>(), "基数ヒープ");
 }
 
+// ===== コピー方式 =====
 /**
- * @brief コンテナの先頭n個の要素を出力する関数
+ * @brief 引数なしの construct を値初期化ではなくデフォルト初期化にするアロケータ
  *
- * @tparam Container コンテナの型
- * @param container 対象のコンテナ
- * @param n 表示する要素数
- * @param container_name コンテナの名前（表示用）
+ * std::vector<T, DefaultInitAllocator<T>> の resize(n) は、算術型などの要素をゼロクリアせずに
+ * 領域だけ確保します。直後に全要素を上書きする場合（memcpy など）の無駄な書き込みを省けます。
  */
-template <typename Container>
-void print_first_n_elements(const Container& container, size_t n, const std::string& container_name) {
-    std::cout << container_name << ": ";
-    // コンテナの要素数より多く表示しようとするのを防ぐ
-    size_t elements_to_print = std::min(n, container.size());
-    // STLアルゴリズムを使い、ループを明示的に書かずに出力する
-    std::copy_n(container.begin(), elements_to_print, std::ostream_iterator<typename Container::value_type>(std::cout, " "));
-    std::cout << std::endl;
-}
+template<typename T>
+struct DefaultInitAllocator : std::allocator<T> {
+    template<typename U>
+    struct rebind {
+        using other = DefaultInitAllocator<U>;
+    };
+
+    DefaultInitAllocator() = default;
+    template<typename U>
+    DefaultInitAllocator(const DefaultInitAllocator<U>&) noexcept {}
+
+    template<typename U>
+    void construct(U* pointer) noexcept(std::is_nothrow_default_constructible_v<U>) {
+        ::new (static_cast<void*>(pointer)) U;
+    }
+    template<typename U, typename... Args>
+    void construct(U* pointer, Args&&... args) {
+        ::new (static_cast<void*>(pointer)) U(std::forward<Args>(args)...);
+    }
+};
 
 /**
- * @brief コンテナの平均値を計算して返すヘルパー関数
+ * @brief 元データからの一括コピーの書き方を、コンテナごとに比較する
+ *
+ * std::back_inserter（要素ごとに容量を確認）、範囲コンストラクタ、assign、insert(end, first, last)、
+ * resize + memcpy（要素が trivially copyable な vector のみ）、ゼロクリアしない resize + memcpy、
+ * 作成済みコンテナからのムーブ構築を計測します。memcpy の 2 方式は連続領域を持つ vector だけが対象です。
+ * ムーブ構築は移動元の作成を計測に含めません。各結果は元データと一致するか検証します。
  */
-template<typename Container>
-double average(const Container& container) {
-    if (container.empty()) {
-        return 0.0;
+template<typename Source>
+void run_copy_variants_benchmark(const Source& src_array) {
+    using T = typename Source::value_type;
+    std::cout << "\n● コピー方式の比較\n";
+    if (src_array.empty()) {
+        return;
+    }
+    const auto first = src_array.begin();
+    const auto last = src_array.end();
+
+    // 計測してから内容を検証する（結果の受け取りはムーブ代入のみ）
+    auto measure = [&](const std::string& label, auto&& copy) {
+        decltype(copy()) container;
+        {
+            CScopeProfiler profiler(label);
+            container = copy();
+        }
+        if (!std::equal(container.begin(), container.end(), first, last)) {
+            std::cerr << "警告: " << label << " の結果が元データと一致しません\n";
+        }
+    };
+    // 範囲を受け取る標準コンテナ共通の方式
+    auto measure_standard = [&](auto empty, const std::string& name) {
+        using Container = decltype(empty);
+        measure(name + "_back_inserter", [&]() {
+            Container container;
+            std::copy(first, last, std::back_inserter(container));
+            return container;
+        });
+        measure(name + "_範囲コンストラクタ", [&]() { return Container(first, last); });
+        measure(name + "_assign", [&]() {
+            Container container;
+            container.assign(first, last);
+            return container;
+        });
+        measure(name + "_insert(end)", [&]() {
+            Container container;
+            container.insert(container.end(), first, last);
+            return container;
+        });
+        Container prepared(first, last);
+        measure(name + "_ムーブ構築", [&]() { return Container(std::move(prepared)); });
+    };
+
+    measure_standard(std::vector<T>(), "vector");
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        measure("vector_resize+memcpy", [&]() {
+            std::vector<T> vector;
+            vector.resize(src_array.size());
+            std::memcpy(vector.data(), src_array.data(), src_array.size() * sizeof(T));
+            return vector;
+        });
+        measure("vector_初期化なしresize+memcpy", [&]() {
+            std::vector<T, DefaultInitAllocator<T>> vector;
+            vector.resize(src_array.size());
+            std::memcpy(vector.data(), src_array.data(), src_array.size() * sizeof(T));
+            return vector;
+        });
+    }
+    measure_standard(std::deque<T>(), "deque");
+    measure_standard(std::list<T>(), "list");
+    measure_standard(CUnrolledList<T>(), "unrolled");
+
+    // リングバッファは容量固定なので、範囲コンストラクタ以外は容量を指定して構築してから書き込む
+    measure("ring_back_inserter", [&]() {
+        CRingBuffer<T> ring(src_array.size());
+        std::copy(first, last, std::back_inserter(ring));
+        return ring;
+    });
+    measure("ring_範囲コンストラクタ", [&]() { return CRingBuffer<T>(first, last); });
+    measure("ring_assign", [&]() {
+        CRingBuffer<T> ring(src_array.size());
+        ring.assign(first, last);
+        return ring;
+    });
+    measure("ring_insert(end)", [&]() {
+        CRingBuffer<T> ring(src_array.size());
+        ring.insert(ring.end(), first, last);
+        return ring;
+    });
+    {
+        CRingBuffer<T> prepared(first, last);
+        measure("ring_ムーブ構築", [&]() { return CRingBuffer<T>(std::move(prepared)); });
     }
-    const double sum = std::accumulate(container.begin(), container.end(), 0.0);
-    return sum / static_cast<double>(container.size());
 }
 
+// ===== 中間挿入と splice =====
 /**
- * @brief コンテナの分散を計算して返すヘルパー関数
+ * @brief 中間位置への挿入と、別コンテナ全体の splice を比較する
  *
- * Welford法（1パス・数値安定）で母分散を計算します。
- * 空コンテナは 0.0 を返します。サンプル分散が必要な場合は
- * `M2 / (n - 1)` に変更してください（n >= 2 前提）。
+ * 挿入は元データで満たしたコンテナの中央を指すイテレータから `MiddleInsertCount` 回、
+ * `it = insert(it, value)` を繰り返します。中央までの位置決め（list / unrolled では O(N) の走査）は
+ * 別に計測します。splice は元データの後半を前半の中央へ移す処理で、list と unrolled は
+ * ノードの付け替え、vector と deque は範囲 insert（要素のコピー）になります。
  */
-template<typename Container>
-double variance(const Container& container) {
-    if (container.empty()) {
-        return 0.0;
-    }
-    // Welford法: 1パスで母分散を算出
-    double count = 0.0;
-    double mean = 0.0;
-    double m2 = 0.0;
-    for (const auto& value : container) {
-        const double x = static_cast<double>(value);
-        count += 1.0;
-        const double delta = x - mean;
-        mean += delta / count;
-        m2 += delta * (x - mean);
+template<typename Source>
+void run_middle_insert_benchmark(const Source& src_array) {
+    using T = typename Source::value_type;
+    std::cout << "\n● 中間挿入と splice（挿入 " << BenchmarkConfig::MiddleInsertCount << " 回）\n";
+    if (src_array.empty()) {
+        return;
     }
-    // count > 0 が保証されるのでそのまま割る（population variance）
-    return m2 / count;
+    const size_t half = src_array.size() / 2;
+
+    auto measure = [&](auto container, const std::string& name) {
+        using Container = decltype(container);
+        constexpr bool node_based = std::is_same_v<Container, std::list<T>> || std::is_same_v<Container, CUnrolledList<T>>;
+        std::copy(src_array.begin(), src_array.end(), std::back_inserter(container));
+        {
+            auto it = container.begin();
+            {
+                CScopeProfiler profiler(name + "_中央への位置決め");
+                it = std::next(container.begin(), static_cast<std::ptrdiff_t>(half));
+            }
+            CScopeProfiler profiler(name + "_中間挿入");
+            for (size_t i = 0; i < BenchmarkConfig::MiddleInsertCount; ++i) {
+                it = container.insert(it, src_array.data()[i % src_array.size()]);
+            }
+        }
+        container.clear();
+        Container tail;
+        std::copy(src_array.begin(), src_array.begin() + half, std::back_inserter(container));
+        std::copy(src_array.begin() + half, src_array.end(), std::back_inserter(tail));
+        const auto position = std::next(container.begin(), static_cast<std::ptrdiff_t>(half / 2));
+        {
+            CScopeProfiler profiler(name + (node_based ? "_splice" : "_範囲insert"));
+            if constexpr (node_based) {
+                container.splice(position, tail);
+            } else {
+                container.insert(position, tail.begin(), tail.end());
+            }
+        }
+        if (container.size() != src_array.size()) {
+            std::cerr << "警告: " << name << " の splice 後の要素数が一致しません\n";
+        }
+    };
+    measure(std::vector<T>(), "vector");
+    measure(std::deque<T>(), "deque");
+    measure(std::list<T>(), "list");
+    measure(CUnrolledList<T>(), "unrolled");
 }
 
 /**
@@ -141,24 +5316,32 @@ double variance(const Container& container) {
  *
  * 各種コンテナに対して、データコピー、シーケンシャル読み取り、統計計算の性能を計測します。
  */
-void run() {
+void run(const RunOptions& options) {
     std::cout << "===== C++コンテナベンチマーク =====\n";
-    std::cout << "要素数: " << BenchmarkConfig::Size << "\n\n";
 
-    // 元データとなる固定長配列
-    static std::array<BenchmarkConfig::DataType, BenchmarkConfig::Size> src_array;
+    // ----- 元データの準備（乱数生成 または ファイル読み込み） -----
+    const CSourceData src_array = [&]() {
+        if (options.input_path.empty()) {
+            std::cout << "● 配列（元データ）に乱数を格納 (シード: " << options.seed << ")\n";
+            return CSourceData::generate(BenchmarkConfig::Size, options.seed);
+        }
+        std::cout << "● データセットファイルを mmap: " << options.input_path << "\n";
+        CScopeProfiler profiler("元データ_mmap");
+        return CSourceData::load(options.input_path);
+    }();
+    std::cout << "要素数: " << src_array.size() << (src_array.is_zero_copy() ? " (ゼロコピー)" : "") << "\n";
+    std::cout << "チェックサム (FNV-1a 64): 0x" << std::hex << std::setw(16) << std::setfill('0') << checksum(src_array)
+              << std::dec << std::setfill(' ') << "\n";
 
     // 各種コンテナの定義
     std::vector<BenchmarkConfig::DataType> vector;  // 動的配列
     std::deque<BenchmarkConfig::DataType> deque;   // 両端キュー
     std::list<BenchmarkConfig::DataType> list;    // 双方向リスト
+    CRingBuffer<BenchmarkConfig::DataType> ring;  // 固定容量リングバッファ（容量はコピー計測内で確保）
+    CUnrolledList<BenchmarkConfig::DataType> unrolled;  // アンロールドリスト（ノードあたり UnrolledChunkSize 要素）
 
     // ----- 各ベンチマークの実行 -----
 
-    // 元データの生成
-    std::cout << "● 固定長配列（元データ）に乱数を格納\n";
-    generate_source_data(src_array, BenchmarkConfig::MinRandomValue, BenchmarkConfig::MaxRandomValue);
-
     // データコピー性能の計測
     std::cout << "\n● データコピー性能\n";
     // vector（メモリ予約なし）へのコピー
@@ -170,7 +5353,7 @@ void run() {
     // vector（メモリ予約あり）へのコピー
     // これ以降のベンチマークで使用する`vec`はこの状態で初期化される
     vector.clear();
-    vector.reserve(BenchmarkConfig::Size);
+    vector.reserve(src_array.size());
     {
         CScopeProfiler profiler("vector_reserveあり");
         std::copy(src_array.begin(), src_array.end(), std::back_inserter(vector));
@@ -181,31 +5364,27 @@ void run() {
         CScopeProfiler profiler("deque");
         std::copy(src_array.begin(), src_array.end(), std::back_inserter(deque));
     }
+    // ringへのコピー（容量の確保とゼロクリアも計測に含め、reserve 後に書き込みで確保する vector と条件を揃える）
+    {
+        CScopeProfiler profiler("ring");
+        ring = CRingBuffer<BenchmarkConfig::DataType>(src_array.size());
+        std::copy(src_array.begin(), src_array.end(), std::back_inserter(ring));
+    }
     // listへのコピー
     list.clear();
     {
         CScopeProfiler profiler("list");
         std::copy(src_array.begin(), src_array.end(), std::back_inserter(list));
     }
+    // unrolledへのコピー
+    unrolled.clear();
+    {
+        CScopeProfiler profiler("unrolled");
+        std::copy(src_array.begin(), src_array.end(), std::back_inserter(unrolled));
+    }
 
     // シーケンシャル読み取り性能の計測
     std::cout << "\n● シーケンシャル読み取り性能 (" << BenchmarkConfig::ReadingRepeat << "回繰り返し)\n";
-    // 各コンテナのデータを指定回数読み取るラムダ関数。
-    // 注意:
-    // 単純に要素を読み取るだけのループは、コンパイラの最適化（デッドコード削除）によって
-    // 処理全体が削除されてしまう可能性があります。
-    // これを防ぎ、確実に読み取り処理を実行させるため、読み取った値を`volatile`修飾子を
-    // 付けた変数(`sink`)に代入しています。`volatile`変数へのアクセスは、コンパイラが
-    // 無視できない副作用と見なすため、ループが維持され、純粋な読み取り性能を計測できます。
-    auto read_container = [](const auto& container) {
-        volatile typename std::decay_t<decltype(container)>::value_type sink{};
-        for (size_t n = 0; n < BenchmarkConfig::ReadingRepeat; ++n) {
-            for (const auto& element : container) {
-                sink = element;
-            }
-        }
-        (void)sink; // sinkが未使用であるというコンパイラ警告を抑制
-    };
     // vectorのシーケンシャル読み取り
     {
         CScopeProfiler profiler("vector");
@@ -216,17 +5395,29 @@ void run() {
         CScopeProfiler profiler("deque");
         read_container(deque);
     }
+    // ringのシーケンシャル読み取り
+    {
+        CScopeProfiler profiler("ring");
+        read_container(ring);
+    }
     // listのシーケンシャル読み取り
     {
         CScopeProfiler profiler("list");
         read_container(list);
     }
+    // unrolledのシーケンシャル読み取り
+    {
+        CScopeProfiler profiler("unrolled");
+        read_container(unrolled);
+    }
 
     // 先頭要素の表示
     std::cout << "\n● 先頭 " << BenchmarkConfig::DisplayCount << " 要素の確認\n";
     print_first_n_elements(vector, BenchmarkConfig::DisplayCount, "vector");
     print_first_n_elements(deque, BenchmarkConfig::DisplayCount, "deque");
+    print_first_n_elements(ring, BenchmarkConfig::DisplayCount, "ring");
     print_first_n_elements(list, BenchmarkConfig::DisplayCount, "list");
+    print_first_n_elements(unrolled, BenchmarkConfig::DisplayCount, "unrolled");
 
     // 統計計算（平均値）の性能を計測
     std::cout << "\n● 平均値計算の性能\n";
@@ -240,11 +5431,21 @@ void run() {
         const double avg_deq = average(deque);
         std::cout << std::fixed << std::setprecision(3) << "dequeの平均値: " << avg_deq << std::endl;
     }
+    {
+        CScopeProfiler profiler("ring_平均値");
+        const double avg_rin = average(ring);
+        std::cout << std::fixed << std::setprecision(3) << "ringの平均値: " << avg_rin << std::endl;
+    }
     {
         CScopeProfiler profiler("list_平均値");
         const double avg_lis = average(list);
         std::cout << std::fixed << std::setprecision(3) << "listの平均値: " << avg_lis << std::endl;
     }
+    {
+        CScopeProfiler profiler("unrolled_平均値");
+        const double avg_unr = average(unrolled);
+        std::cout << std::fixed << std::setprecision(3) << "unrolledの平均値: " << avg_unr << std::endl;
+    }
 
     // 統計計算（分散）の性能を計測
     std::cout << "\n● 分散計算の性能\n";
@@ -258,18 +5459,592 @@ void run() {
         const double var_deq = variance(deque);
         std::cout << std::fixed << std::setprecision(1) << "dequeの分散: " << var_deq << std::endl;
     }
+    {
+        CScopeProfiler profiler("ring_分散");
+        const double var_rin = variance(ring);
+        std::cout << std::fixed << std::setprecision(1) << "ringの分散: " << var_rin << std::endl;
+    }
     {
         CScopeProfiler profiler("list_分散");
         const double var_lis = variance(list);
         std::cout << std::fixed << std::setprecision(1) << "listの分散: " << var_lis << std::endl;
     }
-    
+    {
+        CScopeProfiler profiler("unrolled_分散");
+        const double var_unr = variance(unrolled);
+        std::cout << std::fixed << std::setprecision(1) << "unrolledの分散: " << var_unr << std::endl;
+    }
+
+    // 整数型の平均値: 整数累積の高速パス（average）と double 累積の汎用版（average_floating）の比較
+    std::cout << "\n● 平均値計算: 整数累積 vs double 累積\n";
+    auto compare_average = [](const auto& container, const std::string& name) {
+        {
+            CScopeProfiler profiler(name + "_平均値_double累積");
+            const double avg = average_floating(container);
+            std::cout << std::fixed << std::setprecision(6) << name << "の平均値(double累積): " << avg << std::endl;
+        }
+        {
+            CScopeProfiler profiler(name + "_平均値_整数累積");
+            const double avg = average(container);
+            std::cout << std::fixed << std::setprecision(6) << name << "の平均値(整数累積): " << avg << std::endl;
+        }
+    };
+    compare_average(vector, "vector");
+    compare_average(deque, "deque");
+    compare_average(ring, "ring");
+    compare_average(list, "list");
+    compare_average(unrolled, "unrolled");
+
+    // 1 パスの一括統計（summarize）と個別ヘルパー（average + variance の 2 パス）の比較
+    std::cout << "\n● 一括統計 summarize と個別計算の比較\n";
+    auto compare_summarize = [](const auto& container, const std::string& name) {
+        {
+            CScopeProfiler profiler(name + "_個別(average+variance)");
+            const double avg = average(container);
+            const double var = variance(container);
+            std::cout << std::fixed << std::setprecision(3) << name << "の平均値/分散: " << avg << " / " << var << std::endl;
+        }
+        {
+            CScopeProfiler profiler(name + "_summarize");
+            const auto summary = summarize(container);
+            std::cout << std::fixed << std::setprecision(3) << name << "の平均値/分散: " << summary.mean << " / " << summary.variance
+                      << " (最小 " << summary.min << ", 最大 " << summary.max << ")" << std::endl;
+        }
+        {
+            FixedHistogram histogram = make_observed_histogram(container, BenchmarkConfig::HistogramBuckets);
+            CScopeProfiler profiler(name + "_summarize_ヒストグラム");
+            const auto summary = summarize(container, std::move(histogram));
+            std::cout << std::setprecision(0) << name << "のヒストグラム [" << summary.histogram->low << ", " << summary.histogram->high
+                      << "): ";
+            std::copy(summary.histogram->counts.begin(), summary.histogram->counts.end(), std::ostream_iterator<size_t>(std::cout, " "));
+            std::cout << std::endl;
+        }
+    };
+    compare_summarize(vector, "vector");
+    compare_summarize(deque, "deque");
+    compare_summarize(ring, "ring");
+    compare_summarize(list, "list");
+    compare_summarize(unrolled, "unrolled");
+
+    // 分位点（p50 / p99）: 厳密（nth_element）・固定バケツヒストグラム・KLL スケッチの比較
+    std::cout << "\n● 分位点 (p50 / p99) の性能とメモリ\n";
+    auto compare_quantiles = [](const auto& container, const std::string& name) {
+        using T = typename std::decay_t<decltype(container)>::value_type;
+        {
+            CScopeProfiler profiler(name + "_分位点_nth_element");
+            std::vector<T> scratch;
+            const double p50 = quantile_exact(container, 0.50, scratch);
+            const double p99 = quantile_exact(container, 0.99, scratch);
+            std::cout << std::fixed << std::setprecision(2) << name << " 厳密: p50 " << p50 << " / p99 " << p99
+                      << " (作業メモリ " << scratch.capacity() * sizeof(T) / 1024 << " KiB)" << std::endl;
+        }
+        {
+            // 範囲は既知という前提の手法なので、範囲を求める走査は計測に含めません
+            FixedHistogram histogram = make_observed_histogram(container, BenchmarkConfig::QuantileBuckets);
+            CScopeProfiler profiler(name + "_分位点_ヒストグラム");
+            for (const auto& value : container) {
+                histogram.add(static_cast<double>(value));
+            }
+            std::cout << std::fixed << std::setprecision(2) << name << " ヒストグラム: p50 " << histogram.quantile(0.50) << " / p99 "
+                      << histogram.quantile(0.99) << " (メモリ " << histogram.counts.size() * sizeof(size_t) / 1024 << " KiB)" << std::endl;
+        }
+        {
+            CScopeProfiler profiler(name + "_分位点_KLL");
+            CKllSketch<T> sketch;
+            for (const auto& value : container) {
+                sketch.add(value);
+            }
+            std::cout << std::fixed << std::setprecision(2) << name << " KLL: p50 " << sketch.quantile(0.50) << " / p99 "
+                      << sketch.quantile(0.99) << " (保持 " << sketch.retained() << " 要素, メモリ " << sketch.memory_bytes() / 1024
+                      << " KiB)" << std::endl;
+        }
+    };
+    compare_quantiles(vector, "vector");
+    compare_quantiles(deque, "deque");
+    compare_quantiles(ring, "ring");
+    compare_quantiles(list, "list");
+    compare_quantiles(unrolled, "unrolled");
+
+    // 共有コンテナの同時読み取り（read_container + average + variance を各スレッドで実行）
+    std::cout << "\n● 同時読み取りスケーリング（論理コア数 " << std::thread::hardware_concurrency() << "）\n";
+    measure_read_scaling(vector, "vector");
+    measure_read_scaling(deque, "deque");
+    measure_read_scaling(ring, "ring");
+    measure_read_scaling(list, "list");
+    measure_read_scaling(unrolled, "unrolled");
+
+    run_sort_benchmark(src_array);
+    run_search_benchmark(src_array, options.seed);
+    run_queue_benchmark(src_array, options.seed);
+    run_middle_insert_benchmark(src_array);
+    run_block_deque_benchmark(src_array, options.seed);
+    run_small_container_benchmark(src_array, options.seed);
+    run_layout_benchmark(src_array);
+    run_intrusive_list_benchmark(src_array);
+    run_colony_benchmark(src_array, options.seed);
+    run_associative_benchmark(src_array, options.seed);
+    run_ordered_benchmark(src_array, options.seed);
+    run_priority_queue_benchmark(src_array);
+    run_copy_variants_benchmark(src_array);
+    run_handoff_benchmark(src_array);
+    run_accumulator_layout_benchmark(src_array);
+    run_work_stealing_benchmark(src_array);
+
     std::cout << "\n===== ベンチマーク終了 =====\n";
 }
 
+// ===== ストリーミング統計 =====
+/**
+ * @brief ストリーミング計測の結果
+ */
+struct StreamResult {
+    WelfordState state;      // 全チャンクを結合した統計量
+    size_t bytes = 0;        // 処理したデータ部のバイト数
+    double io_ms = 0.0;      // I/O（read / ページフォルト）に費やした時間
+    double compute_ms = 0.0; // 統計量の計算に費やした時間
+    double wall_ms = 0.0;    // 全体の経過時間
+};
+
+/**
+ * @brief 読み取り用にファイルを開いた RAII ハンドル
+ */
+class CFileDescriptor final {
+public:
+    explicit CFileDescriptor(const std::string& path) : m_fd(::open(path.c_str(), O_RDONLY)) {
+        if (m_fd < 0) {
+            throw std::runtime_error("ファイルを開けません: " + path + " (" + std::strerror(errno) + ")");
+        }
+    }
+    ~CFileDescriptor() { ::close(m_fd); }
+    CFileDescriptor(const CFileDescriptor&) = delete;
+    CFileDescriptor& operator=(const CFileDescriptor&) = delete;
+
+    int get() const { return m_fd; }
+
+private:
+    int m_fd;  // ファイルディスクリプタ
+};
+
+/**
+ * @brief データセットファイルのデータ部の位置と要素数を調べる
+ *
+ * ファイル全体は読まず、.npy ならヘッダ部分だけを pread します。
+ * ストリーミングでは変換コピーを行わないため、dtype は `DataType` と一致している必要があります。
+ */
+inline NpyHeader probe_dataset(int fd, const std::string& path) {
+    using T = BenchmarkConfig::DataType;
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        throw std::runtime_error("ファイル情報を取得できません: " + path + " (" + std::strerror(errno) + ")");
+    }
+    const size_t file_size = static_cast<size_t>(st.st_size);
+    NpyHeader header;
+    if (has_npy_extension(path)) {
+        std::vector<unsigned char> head(std::min<size_t>(file_size, 1 << 16));
+        if (::pread(fd, head.data(), head.size(), 0) != static_cast<ssize_t>(head.size())) {
+            throw std::runtime_error("NPY ヘッダを読み込めません: " + path);
+        }
+        header = parse_npy_header(head.data(), head.size());
+        if (header.descr != npy_descr<T>() || header.count > (file_size - header.data_offset) / sizeof(T)) {
+            throw std::runtime_error("stream は dtype " + npy_descr<T>() + " の NPY のみ対応しています: " + path);
+        }
+    } else {
+        if (file_size % sizeof(T) != 0) {
+            throw std::runtime_error("raw ファイルのサイズが要素サイズの倍数ではありません: " + path);
+        }
+        header.descr = npy_descr<T>();
+        header.count = file_size / sizeof(T);
+    }
+    if (!is_little_endian()) {
+        throw std::runtime_error("ビッグエンディアン環境でのストリーミングには対応していません");
+    }
+    return header;
+}
+
+/**
+ * @brief read() で固定長チャンクを読み込み、チャンクごとに Welford 状態を結合する
+ *
+ * 読み込みと計算は同じスレッドで交互に行うため、重なりは生じません（比較の基準）。
+ */
+inline StreamResult stream_with_read(const std::string& path, size_t chunk_bytes) {
+    using T = BenchmarkConfig::DataType;
+    CFileDescriptor file(path);
+    const NpyHeader header = probe_dataset(file.get(), path);
+    ::posix_fadvise(file.get(), 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    StreamResult result;
+    std::vector<T> buffer(chunk_bytes / sizeof(T));
+    const size_t total_bytes = header.count * sizeof(T);
+    const auto wall_start = std::chrono::steady_clock::now();
+    while (result.bytes < total_bytes) {
+        // ----- I/O: チャンクが埋まるまで pread -----
+        const auto io_start = std::chrono::steady_clock::now();
+        const size_t want = std::min(buffer.size() * sizeof(T), total_bytes - result.bytes);
+        size_t got = 0;
+        while (got < want) {
+            const ssize_t n = ::pread(file.get(), reinterpret_cast<char*>(buffer.data()) + got, want - got,
+                                      static_cast<off_t>(header.data_offset + result.bytes + got));
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                throw std::runtime_error("読み込みに失敗しました: " + path);
+            }
+            got += static_cast<size_t>(n);
+        }
+        result.io_ms += elapsed_milliseconds(io_start);
+        // ----- 計算: チャンク単位の状態を作って結合 -----
+        const auto compute_start = std::chrono::steady_clock::now();
+        result.state.merge(welford_fold(buffer.data(), buffer.data() + got / sizeof(T)));
+        result.compute_ms += elapsed_milliseconds(compute_start);
+        result.bytes += got;
+    }
+    result.wall_ms = elapsed_milliseconds(wall_start);
+    return result;
+}
+
+/**
+ * @brief ファイルをチャンクサイズのウィンドウ単位で mmap しながら統計量を計算する
+ *
+ * `willneed` が true なら現在のウィンドウを処理する前に次のウィンドウへ POSIX_FADV_WILLNEED を発行し、
+ * カーネルの非同期先読みを計算と重ねます。各ウィンドウはページを 1 バイトずつ触れて読み込みを完了させ、
+ * その時間を I/O として計上してから計算します。I/O と計算は同じスレッドで交互に行うため、先読みの効果は
+ * 重なり率ではなく、先読み指示の有無による I/O 時間の差に表れます。
+ */
+inline StreamResult stream_with_mmap(const std::string& path, size_t chunk_bytes, bool willneed) {
+    using T = BenchmarkConfig::DataType;
+    CFileDescriptor file(path);
+    const NpyHeader header = probe_dataset(file.get(), path);
+    if (header.data_offset % alignof(T) != 0) {
+        throw std::runtime_error("データ部のアライメントが不正なため mmap ウィンドウを使えません: " + path);
+    }
+    const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+
+    StreamResult result;
+    const size_t total_bytes = header.count * sizeof(T);
+    const auto wall_start = std::chrono::steady_clock::now();
+    while (result.bytes < total_bytes) {
+        const size_t want = std::min(chunk_bytes, total_bytes - result.bytes);
+        const size_t file_offset = header.data_offset + result.bytes;
+        const size_t map_offset = file_offset / page_size * page_size;  // mmap のオフセットはページ境界が必須
+        const size_t map_length = file_offset - map_offset + want;
+
+        // ----- I/O: マップ・次ウィンドウの先読み指示・ページの読み込み -----
+        const auto io_start = std::chrono::steady_clock::now();
+        void* addr = ::mmap(nullptr, map_length, PROT_READ, MAP_PRIVATE, file.get(), static_cast<off_t>(map_offset));
+        if (addr == MAP_FAILED) {
+            throw std::runtime_error("mmap に失敗しました: " + path + " (" + std::strerror(errno) + ")");
+        }
+        if (willneed) {
+            ::posix_fadvise(file.get(), static_cast<off_t>(file_offset + want), static_cast<off_t>(chunk_bytes),
+                            POSIX_FADV_WILLNEED);
+        }
+        const auto* bytes = static_cast<const unsigned char*>(addr);
+        volatile unsigned char sink = 0;
+        for (size_t page = 0; page < map_length; page += page_size) {
+            sink = bytes[page];
+        }
+        (void)sink;
+        result.io_ms += elapsed_milliseconds(io_start);
+
+        // ----- 計算 -----
+        const auto compute_start = std::chrono::steady_clock::now();
+        const auto* first = reinterpret_cast<const T*>(bytes + (file_offset - map_offset));
+        result.state.merge(welford_fold(first, first + want / sizeof(T)));
+        result.compute_ms += elapsed_milliseconds(compute_start);
+
+        ::munmap(addr, map_length);
+        result.bytes += want;
+    }
+    result.wall_ms = elapsed_milliseconds(wall_start);
+    return result;
+}
+
+/**
+ * @brief 読み込みスレッドと計算スレッドを並行させるダブルバッファ方式
+ *
+ * 読み込みスレッドが空きバッファへ pread し、満たしたバッファ番号を SPSC キューで計算スレッド
+ * （呼び出し元スレッド）へ渡します。計算スレッドはチャンクを Welford 状態へ畳み込み、バッファ番号を
+ * 別の SPSC キューで返却します。`PipelineBuffers` 個のバッファが循環するため、I/O と計算が重なります。
+ */
+inline StreamResult stream_with_pipeline(const std::string& path, size_t chunk_bytes) {
+    using T = BenchmarkConfig::DataType;
+    CFileDescriptor file(path);
+    const NpyHeader header = probe_dataset(file.get(), path);
+    ::posix_fadvise(file.get(), 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    // 受け渡し単位: バッファ番号と有効バイト数（0 バイトは終端）
+    struct Chunk {
+        size_t buffer = 0;
+        size_t bytes = 0;
+    };
+    std::vector<std::vector<T>> buffers(BenchmarkConfig::PipelineBuffers, std::vector<T>(chunk_bytes / sizeof(T)));
+    CSpscRing<Chunk> filled(buffers.size());   // 読み込み済み: 読み込み → 計算
+    CSpscRing<size_t> free_list(buffers.size());  // 空き: 計算 → 読み込み
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        free_list.push(i);
+    }
+
+    StreamResult result;
+    const size_t total_bytes = header.count * sizeof(T);
+    std::exception_ptr reader_error;
+    const auto wall_start = std::chrono::steady_clock::now();
+
+    // ----- 読み込みスレッド -----
+    std::thread reader([&]() {
+        try {
+            for (size_t offset = 0; offset < total_bytes;) {
+                const size_t index = free_list.pop();
+                const auto io_start = std::chrono::steady_clock::now();
+                const size_t want = std::min(chunk_bytes, total_bytes - offset);
+                size_t got = 0;
+                while (got < want) {
+                    const ssize_t n = ::pread(file.get(), reinterpret_cast<char*>(buffers[index].data()) + got, want - got,
+                                              static_cast<off_t>(header.data_offset + offset + got));
+                    if (n < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    if (n <= 0) {
+                        throw std::runtime_error("読み込みに失敗しました: " + path);
+                    }
+                    got += static_cast<size_t>(n);
+                }
+                result.io_ms += elapsed_milliseconds(io_start);  // io_ms は読み込みスレッドだけが更新
+                filled.push(Chunk{index, got});
+                offset += got;
+            }
+        } catch (...) {
+            reader_error = std::current_exception();
+        }
+        filled.push(Chunk{0, 0});
+    });
+
+    // ----- 計算スレッド（呼び出し元） -----
+    for (Chunk chunk = filled.pop(); chunk.bytes > 0; chunk = filled.pop()) {
+        const auto compute_start = std::chrono::steady_clock::now();
+        const T* first = buffers[chunk.buffer].data();
+        result.state.merge(welford_fold(first, first + chunk.bytes / sizeof(T)));
+        result.compute_ms += elapsed_milliseconds(compute_start);
+        result.bytes += chunk.bytes;
+        free_list.push(chunk.buffer);
+    }
+    reader.join();
+    result.wall_ms = elapsed_milliseconds(wall_start);
+    if (reader_error) {
+        std::rethrow_exception(reader_error);
+    }
+    return result;
+}
+
+/**
+ * @brief ファイルのページをページキャッシュから破棄するようカーネルに依頼する（POSIX_FADV_DONTNEED）
+ *
+ * 変更されていないページだけが対象で、権限は不要です。先読み指示の有無を同じ条件で比べるために使います。
+ */
+inline void evict_page_cache(const std::string& path) {
+    CFileDescriptor file(path);
+    ::posix_fadvise(file.get(), 0, 0, POSIX_FADV_DONTNEED);
+}
+
+/**
+ * @brief ストリーミング計測の結果を表示する
+ *
+ * `concurrent` が true（I/O と計算を別スレッドで行う方式）の場合だけ重なり率を表示します。
+ * 重なり率は (I/O + 計算 - 全体) / min(I/O, 計算) で、0% なら完全に交互実行、
+ * 100% なら短い方の処理が長い方の裏に完全に隠れていることを表します。単一スレッドの方式では常に 0% です。
+ */
+inline void print_stream_result(const std::string& label, const StreamResult& result, bool concurrent) {
+    const double gb_per_sec = result.wall_ms > 0.0 ? static_cast<double>(result.bytes) / (result.wall_ms * 1e6) : 0.0;
+    std::cout << std::fixed << std::setprecision(3) << label << "の平均値: " << result.state.mean << "\n"
+              << std::setprecision(1) << label << "の分散: " << result.state.variance() << "\n"
+              << std::setprecision(2) << label << ": " << gb_per_sec << " GB/s (I/O " << result.io_ms << " ms / 計算 "
+              << result.compute_ms << " ms / 全体 " << result.wall_ms << " ms";
+    if (concurrent) {
+        const double shorter = std::min(result.io_ms, result.compute_ms);
+        const double overlap = shorter > 0.0 ? std::max(0.0, result.io_ms + result.compute_ms - result.wall_ms) / shorter : 0.0;
+        std::cout << " / 重なり率 " << overlap * 100.0 << " %";
+    }
+    std::cout << ")\n";
+}
+
+/**
+ * @brief stream サブコマンドの本体
+ *
+ * メモリに載らないデータセットを想定し、固定長チャンクだけを保持しながら平均と分散を求めます。
+ */
+void run_stream(const RunOptions& options) {
+    using T = BenchmarkConfig::DataType;
+    // チャンクはページと要素の両方の倍数に切り上げる
+    const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const size_t unit = std::lcm(page_size, sizeof(T));
+    const size_t chunk_bytes = std::max(unit, (options.chunk_bytes + unit - 1) / unit * unit);
+
+    std::cout << "===== C++ストリーミング統計 =====\n";
+    std::cout << "入力: " << options.input_path << "\n";
+    std::cout << "チャンク: " << chunk_bytes << " バイト\n";
+    std::cout << "※ ページキャッシュに載っている場合は I/O が速く見えます（コールド計測はキャッシュを破棄してから実行）\n";
+
+    if (options.stream_io == StreamIo::All || options.stream_io == StreamIo::Read) {
+        std::cout << "\n● read() チャンク読み込み\n";
+        StreamResult result;
+        {
+            CScopeProfiler profiler("stream_read");
+            result = stream_with_read(options.input_path, chunk_bytes);
+        }
+        print_stream_result("read", result, false);
+    }
+    if (options.stream_io == StreamIo::All || options.stream_io == StreamIo::Mmap) {
+        // 先読み指示の有無で I/O 時間を比べる（各回の前にファイルのページキャッシュを破棄）
+        std::cout << "\n● mmap ウィンドウ（WILLNEED 先読みの有無, 各回の前にページキャッシュを破棄）\n";
+        std::array<double, 2> io_ms{};  // [先読みなし, WILLNEED]
+        for (const bool willneed : {false, true}) {
+            const std::string label = willneed ? "mmap_WILLNEED" : "mmap_先読みなし";
+            evict_page_cache(options.input_path);
+            StreamResult result;
+            {
+                CScopeProfiler profiler("stream_" + label);
+                result = stream_with_mmap(options.input_path, chunk_bytes, willneed);
+            }
+            print_stream_result(label, result, false);
+            io_ms[willneed ? 1 : 0] = result.io_ms;
+        }
+        std::cout << std::fixed << std::setprecision(2) << "WILLNEED による I/O 時間の短縮: " << io_ms[0] - io_ms[1] << " ms\n";
+    }
+    if (options.stream_io == StreamIo::All || options.stream_io == StreamIo::Pipeline) {
+        std::cout << "\n● パイプライン（読み込みスレッド + 計算スレッド, バッファ " << BenchmarkConfig::PipelineBuffers << " 個）\n";
+        StreamResult result;
+        {
+            CScopeProfiler profiler("stream_pipeline");
+            result = stream_with_pipeline(options.input_path, chunk_bytes);
+        }
+        print_stream_result("pipeline", result, true);
+    }
+    std::cout << "\n===== ストリーミング終了 =====\n";
+}
+
+// ===== コマンドライン処理 =====
+/**
+ * @brief 使い方を出力する
+ */
+void print_usage(const char* program) {
+    std::cerr << "使い方:\n"
+              << "  " << program << " [--seed N] [--input FILE]\n"
+              << "  " << program << " generate FILE [--count N] [--seed N]\n"
+              << "  " << program << " stream FILE [--chunk-bytes N] [--io all|read|mmap|pipeline]\n"
+              << "  --seed N      元データ生成の乱数シード（既定: " << BenchmarkConfig::DefaultSeed << "）\n"
+              << "  --input FILE  元データを raw / .npy ファイルから mmap で読み込む\n"
+              << "  --count N     generate で書き出す要素数（既定: " << BenchmarkConfig::Size << "）\n"
+              << "  generate FILE 乱数データセットを書き出す（.npy なら NPY 形式、それ以外は raw int32 LE）\n"
+              << "  stream FILE   ファイルをチャンク単位で読みながら平均・分散を計算する\n"
+              << "  --chunk-bytes N  stream のチャンクサイズ（既定: " << BenchmarkConfig::StreamChunkBytes << "）\n"
+              << "  --io MODE     stream の読み込み方式（既定: all）\n";
+}
+
+/**
+ * @brief 0 以上の整数オプションを変換する
+ * @throws std::invalid_argument 数字以外を含む場合
+ */
+std::uint64_t parse_unsigned(const std::string& name, const std::string& value) {
+    // std::stoull は負数を受け付けてしまうため、先に数字のみかを確認する
+    if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos) {
+        throw std::invalid_argument(name + " には 0 以上の整数を指定してください: " + value);
+    }
+    return std::stoull(value);
+}
+
+/**
+ * @brief コマンドライン引数を解析して実行時オプションを返す
+ *
+ * `--name value` と `--name=value` の両形式を受け付けます。不正な引数は std::invalid_argument を送出します。
+ */
+RunOptions parse_options(int argc, char* argv[]) {
+    RunOptions options;
+    int first = 1;
+    const std::string subcommand = argc > 1 ? argv[1] : "";
+    if (subcommand == "generate" || subcommand == "stream") {
+        if (argc < 3) {
+            throw std::invalid_argument(subcommand + " にはファイルの指定が必要です");
+        }
+        if (subcommand == "generate") {
+            options.command = Command::Generate;
+            options.output_path = argv[2];
+        } else {
+            options.command = Command::Stream;
+            options.input_path = argv[2];
+        }
+        first = 3;
+    }
+    // 現在のコマンドで使えるオプションか（不明なオプションが次の引数を値として取り込まないよう先に判定する）
+    auto is_known = [&](const std::string& arg) {
+        return arg == "--seed" || (arg == "--input" && options.command == Command::Run) ||
+               (arg == "--count" && options.command == Command::Generate) ||
+               ((arg == "--chunk-bytes" || arg == "--io") && options.command == Command::Stream);
+    };
+    for (int i = first; i < argc; ++i) {
+        std::string arg = argv[i];
+        std::string value;
+        const auto eq = arg.find('=');
+        if (eq != std::string::npos) {
+            value = arg.substr(eq + 1);
+            arg.erase(eq);
+        }
+        if (!is_known(arg)) {
+            throw std::invalid_argument("不明な引数です: " + arg);
+        }
+        if (eq == std::string::npos) {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument(arg + " には値が必要です");
+            }
+            value = argv[++i];
+        }
+        if (arg == "--seed") {
+            options.seed = parse_unsigned(arg, value);
+        } else if (arg == "--input") {
+            options.input_path = value;
+        } else if (arg == "--count") {
+            options.count = parse_unsigned(arg, value);
+        } else if (arg == "--chunk-bytes") {
+            options.chunk_bytes = parse_unsigned(arg, value);
+        } else if (arg == "--io") {
+            if (value == "all") {
+                options.stream_io = StreamIo::All;
+            } else if (value == "read") {
+                options.stream_io = StreamIo::Read;
+            } else if (value == "mmap") {
+                options.stream_io = StreamIo::Mmap;
+            } else if (value == "pipeline") {
+                options.stream_io = StreamIo::Pipeline;
+            } else {
+                throw std::invalid_argument("--io には all / read / mmap / pipeline のいずれかを指定してください: " + value);
+            }
+        }
+    }
+    return options;
+}
+
 // ===== エントリポイント =====
-int main() {
-    CScopeProfiler profiler("全体処理");
-    run();
+int main(int argc, char* argv[]) {
+    RunOptions options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "エラー: " << e.what() << "\n";
+        print_usage(argv[0]);
+        return 1;
+    }
+    try {
+        CScopeProfiler profiler("全体処理");
+        if (options.command == Command::Generate) {
+            write_dataset(options.output_path, options.count, options.seed);
+            std::cout << options.count << " 要素を書き出しました: " << options.output_path << "\n";
+        } else if (options.command == Command::Stream) {
+            run_stream(options);
+        } else {
+            run(options);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "エラー: " << e.what() << "\n";
+        return 1;
+    }
     return 0;
 }
@@ -28,6 +28,8 @@ mod config {
     pub const RANDOM_MIN: DataType = -100;
     /// 乱数の最大値（含む）。
     pub const RANDOM_MAX: DataType = 100;
+    /// 既定の乱数シード（C++ 版 `BenchmarkConfig::DefaultSeed` と同じ値）。
+    pub const DEFAULT_SEED: u64 = 5489;
 }
 
 /// スコープ生存期間で経過時間を測定し、ドロップ時に表示する簡易プロファイラ。
@@ -127,6 +129,11 @@ impl Mt19937 {
     }
 
     /// `[min, max]` の一様整数を生成する。
+    ///
+    /// C++ 版 `draw_uniform_int` と共通の写像:
+    /// 1. 64bit 値 = (1回目の出力 << 32) | 2回目の出力
+    /// 2. `span = max - min + 1`、`zone = (2^64 - 1) - ((2^64 - 1) % span)`
+    /// 3. 値 >= `zone` なら棄却して 1 へ戻り、そうでなければ `min + (値 % span)` を返す
     #[inline]
     pub fn next_i32_range(&mut self, min: i32, max: i32) -> i32 {
         debug_assert!(min <= max);
@@ -150,21 +157,26 @@ impl Mt19937 {
 /// # 引数
 /// - `size`: 生成する要素数
 /// - `min_v`, `max_v`: 乱数範囲（両端含む）
+/// - `seed`: 乱数シード（同じ値なら C++ 版と同一の配列になる）
 ///
 /// # 戻り値
 /// 乱数で埋めた `Vec<i32>`。
-fn generate_source(size: usize, min_v: i32, max_v: i32) -> Vec<i32> {
-    let seed = std::time::SystemTime::now()
-        .duration_since(std::time::UNIX_EPOCH)
-        .unwrap_or_default()
-        .as_nanos() as u64;
-
+fn generate_source(size: usize, min_v: i32, max_v: i32, seed: u64) -> Vec<i32> {
     let _profiler = ScopeProfiler::new("乱数配列生成");
     let mut rng = Mt19937::new(seed);
 
     (0..size).map(|_| rng.next_i32_range(min_v, max_v)).collect()
 }
 
+/// データ列のチェックサム（FNV-1a 64bit）を求める。
+///
+/// 各要素をリトルエンディアンのバイト列として順に投入する。C++ 版 `checksum` と同じ定義。
+fn checksum(values: &[i32]) -> u64 {
+    values.iter().flat_map(|v| v.to_le_bytes()).fold(0xcbf2_9ce4_8422_2325u64, |hash, byte| {
+        (hash ^ byte as u64).wrapping_mul(0x0000_0100_0000_01b3)
+    })
+}
+
 /// 先頭 `n` 要素を 1 行で出力する（スペース区切り）。
 ///
 /// # 引数
@@ -228,16 +240,49 @@ where
         .sum()
 }
 
+/// コマンドライン引数から決まる設定値。
+struct RunOptions {
+    /// 元データ生成に使う乱数シード。
+    seed: u64,
+}
+
+/// コマンドライン引数を解析する。`--name value` と `--name=value` の両形式を受け付ける。
+fn parse_options(args: &[String]) -> Result<RunOptions, String> {
+    let mut options = RunOptions { seed: config::DEFAULT_SEED };
+    let mut iter = args.iter();
+    while let Some(arg) = iter.next() {
+        let (name, inline_value) = match arg.split_once('=') {
+            Some((name, value)) => (name, Some(value.to_string())),
+            None => (arg.as_str(), None),
+        };
+        match name {
+            "--seed" => {
+                let value = match inline_value {
+                    Some(value) => value,
+                    None => iter.next().cloned().ok_or_else(|| format!("{} には値が必要です", name))?,
+                };
+                options.seed = value
+                    .parse::<u64>()
+                    .map_err(|_| format!("--seed には 0 以上の整数を指定してください: {}", value))?;
+            }
+            _ => return Err(format!("不明な引数です: {}", arg)),
+        }
+    }
+    Ok(options)
+}
+
 /// ベンチマーク本体。各処理を独立に測定・出力する。
-fn run() {
+fn run(options: &RunOptions) {
     use config::*;
 
     println!("===== Rust コンテナ・ベンチマーク =====");
-    println!("要素数: {}\n", ELEMENT_COUNT);
+    println!("要素数: {}", ELEMENT_COUNT);
+    println!("シード: {}\n", options.seed);
 
     // 元データ生成
     println!("● 元データ生成");
-    let src = generate_source(ELEMENT_COUNT, RANDOM_MIN, RANDOM_MAX);
+    let src = generate_source(ELEMENT_COUNT, RANDOM_MIN, RANDOM_MAX, options.seed);
+    println!("チェックサム (FNV-1a 64): 0x{:016x}", checksum(&src));
 
     // --- データコピー性能（ケースごとに新しいコンテナを生成） ---
     println!("\n● データコピー性能");
@@ -326,6 +371,16 @@ fn run() {
 
 /// エントリポイント。
 fn main() {
+    let args: Vec<String> = std::env::args().collect();
+    let options = match parse_options(&args[1..]) {
+        Ok(options) => options,
+        Err(message) => {
+            eprintln!("エラー: {}", message);
+            eprintln!("使い方: {} [--seed N]", args[0]);
+            eprintln!("  --seed N  元データ生成の乱数シード（既定: {}）", config::DEFAULT_SEED);
+            std::process::exit(1);
+        }
+    };
     let _profiler = ScopeProfiler::new("全体処理");
-    run();
+    run(&options);
 }